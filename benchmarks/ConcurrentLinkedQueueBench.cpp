@@ -0,0 +1,64 @@
+#include "LinkedList/ConcurrentLinkedQueue.hpp"
+#include "LockedLinkedList.hpp"
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+// Even threads produce and odd threads consume, so ThreadRange(2, N) scales
+// producers and consumers together. Consumers count only successful pops.
+template <typename Queue>
+void BM_ProducersConsumers(benchmark::State& state) {
+    static Queue queue;
+    const bool producer = state.thread_index() % 2 == 0;
+
+    std::int64_t items{};
+    for (auto _ : state) {
+        if (producer) {
+            queue.push_back(1);
+            ++items;
+        } else if (queue.try_pop_front()) {
+            ++items;
+        }
+    }
+    state.SetItemsProcessed(items);
+
+    // Leave the queue empty for the next run.
+    if (state.thread_index() == 0) {
+        while (queue.try_pop_front());
+    }
+}
+
+// Every thread alternates enqueue and dequeue.
+template <typename Queue>
+void BM_PushPop(benchmark::State& state) {
+    static Queue queue;
+
+    for (auto _ : state) {
+        queue.push_back(1);
+        benchmark::DoNotOptimize(queue.try_pop_front());
+    }
+    state.SetItemsProcessed(2 * state.iterations());
+}
+
+}
+
+BENCHMARK(BM_ProducersConsumers<ConcurrentLinkedQueue<int>>)
+    ->Name("ConcurrentLinkedQueue/ProducersConsumers")
+    ->ThreadRange(2, 32)
+    ->UseRealTime();
+
+BENCHMARK(BM_ProducersConsumers<LockedLinkedList<int>>)
+    ->Name("LockedLinkedList/ProducersConsumers")
+    ->ThreadRange(2, 32)
+    ->UseRealTime();
+
+BENCHMARK(BM_PushPop<ConcurrentLinkedQueue<int>>)
+    ->Name("ConcurrentLinkedQueue/PushPop")
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
+
+BENCHMARK(BM_PushPop<LockedLinkedList<int>>)
+    ->Name("LockedLinkedList/PushBackPopFront")
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
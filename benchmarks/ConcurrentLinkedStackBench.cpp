@@ -0,0 +1,51 @@
+#include "LinkedList/ConcurrentLinkedStack.hpp"
+#include "LockedLinkedList.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+namespace {
+
+template <typename Stack>
+void BM_PushPop(benchmark::State& state) {
+    static Stack stack;
+
+    for (auto _ : state) {
+        stack.push_front(1);
+        benchmark::DoNotOptimize(stack.try_pop_front());
+    }
+    state.SetItemsProcessed(2 * state.iterations());
+}
+
+void BM_ConcurrentStackPushRange(benchmark::State& state) {
+    static ConcurrentLinkedStack<int> stack;
+    const std::vector<int> batch(static_cast<std::size_t>(state.range(0)), 1);
+
+    for (auto _ : state) {
+        stack.push_range(batch);
+        for (std::size_t i{}; i < batch.size(); ++i) {
+            benchmark::DoNotOptimize(stack.try_pop_front());
+        }
+    }
+    state.SetItemsProcessed(
+        2 * state.iterations() * static_cast<std::int64_t>(batch.size()));
+}
+
+}
+
+BENCHMARK(BM_PushPop<ConcurrentLinkedStack<int>>)
+    ->Name("ConcurrentLinkedStack/PushPop")
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+BENCHMARK(BM_PushPop<LockedLinkedList<int>>)
+    ->Name("LockedLinkedList/PushPop")
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+BENCHMARK(BM_ConcurrentStackPushRange)
+    ->Name("ConcurrentLinkedStack/PushRange")
+    ->Arg(64)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
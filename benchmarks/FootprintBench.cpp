@@ -0,0 +1,107 @@
+#include "LinkedList/LinkedList.hpp"
+#include "LinkedList/MemoryUsage.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <forward_list>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+// Bytes per element that LinkedList, std::forward_list and std::vector
+// request from their allocator for several element types, measured with a
+// ByteCountingResource. Reported as counters; the time is that of building
+// the container. Memory owned by the elements themselves is not included.
+
+namespace {
+
+struct Payload64 {
+    std::array<std::int64_t, 8> values{};
+};
+
+template <typename T>
+T make_element(std::int64_t i) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        return std::to_string(i);
+    } else if constexpr (std::is_same_v<T, Payload64>) {
+        return Payload64{{i}};
+    } else {
+        return static_cast<T>(i);
+    }
+}
+
+template <typename T>
+void fill(pmr::LinkedList<T>& ll, std::int64_t count) {
+    for (std::int64_t i{}; i < count; ++i) {
+        ll.push_back(make_element<T>(i));
+    }
+}
+
+template <typename T>
+void fill(std::pmr::forward_list<T>& fl, std::int64_t count) {
+    auto last = fl.before_begin();
+    for (std::int64_t i{}; i < count; ++i) {
+        last = fl.insert_after(last, make_element<T>(i));
+    }
+}
+
+template <typename T>
+void fill(std::pmr::vector<T>& v, std::int64_t count) {
+    for (std::int64_t i{}; i < count; ++i) {
+        v.push_back(make_element<T>(i));
+    }
+}
+
+void element_counts(benchmark::internal::Benchmark* benchmark) {
+    benchmark->RangeMultiplier(100)->Range(100, 1'000'000);
+    benchmark->Unit(benchmark::kMicrosecond);
+}
+
+template <typename Container>
+void BM_Footprint(benchmark::State& state) {
+    const auto count = state.range(0);
+    std::size_t in_use{};
+    std::size_t peak{};
+
+    for (auto _ : state) {
+        ByteCountingResource resource;
+        {
+            Container container{&resource};
+            fill(container, count);
+            benchmark::DoNotOptimize(container);
+            in_use = resource.bytes_in_use();
+        }
+        peak = resource.peak_bytes();
+    }
+
+    const auto elements = static_cast<double>(count);
+    state.counters["bytes_per_element"] =
+        static_cast<double>(in_use) / elements;
+    state.counters["peak_bytes_per_element"] =
+        static_cast<double>(peak) / elements;
+}
+
+}
+
+BENCHMARK_TEMPLATE(BM_Footprint, pmr::LinkedList<std::int32_t>)
+    ->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Footprint, std::pmr::forward_list<std::int32_t>)
+    ->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Footprint, std::pmr::vector<std::int32_t>)
+    ->Apply(element_counts);
+
+BENCHMARK_TEMPLATE(BM_Footprint, pmr::LinkedList<std::string>)
+    ->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Footprint, std::pmr::forward_list<std::string>)
+    ->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Footprint, std::pmr::vector<std::string>)
+    ->Apply(element_counts);
+
+BENCHMARK_TEMPLATE(BM_Footprint, pmr::LinkedList<Payload64>)
+    ->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Footprint, std::pmr::forward_list<Payload64>)
+    ->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Footprint, std::pmr::vector<Payload64>)
+    ->Apply(element_counts);
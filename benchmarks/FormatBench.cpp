@@ -0,0 +1,102 @@
+#include "LinkedList/LinkedList.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <ranges>
+#include <sstream>
+#include <string>
+
+// Dumping a list as text: std::format through LinkedListFormatter, against
+// formatting every element with its own std::format_to call, plus the
+// truncated mode used for logging and operator<<.
+
+namespace {
+
+void element_counts(benchmark::internal::Benchmark* benchmark) {
+    benchmark->RangeMultiplier(10)->Range(1'000, 1'000'000);
+    benchmark->Unit(benchmark::kMicrosecond);
+}
+
+LinkedList<int> make_list(benchmark::State& state) {
+    return {std::from_range,
+            std::views::iota(0, static_cast<int>(state.range(0)))};
+}
+
+void BM_Format(benchmark::State& state) {
+    const auto ll = make_list(state);
+    std::string out;
+
+    for (auto _ : state) {
+        out.clear();
+        std::format_to(std::back_inserter(out), "{}", ll);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(
+        state.iterations() * static_cast<std::int64_t>(out.size()));
+}
+
+void BM_FormatPerElementCalls(benchmark::State& state) {
+    const auto ll = make_list(state);
+    std::string out;
+
+    for (auto _ : state) {
+        out.clear();
+        auto it = std::back_inserter(out);
+        std::format_to(it, "[");
+        std::ranges::for_each(ll, [&it](const auto& element) {
+            std::format_to(it, "{} {} ", element, "->"); });
+        std::format_to(it, "NULL]");
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(
+        state.iterations() * static_cast<std::int64_t>(out.size()));
+}
+
+void BM_FormatHex(benchmark::State& state) {
+    const auto ll = make_list(state);
+    std::string out;
+
+    for (auto _ : state) {
+        out.clear();
+        std::format_to(std::back_inserter(out), "{::#x}", ll);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_FormatTruncated(benchmark::State& state) {
+    const auto ll = make_list(state);
+    std::string out;
+
+    for (auto _ : state) {
+        out.clear();
+        std::format_to(std::back_inserter(out), "{:.16}", ll);
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+
+void BM_OutputStream(benchmark::State& state) {
+    const auto ll = make_list(state);
+    std::ostringstream os;
+
+    for (auto _ : state) {
+        os.str("");
+        os << ll;
+        benchmark::DoNotOptimize(os);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}
+
+BENCHMARK(BM_Format)->Apply(element_counts);
+BENCHMARK(BM_FormatPerElementCalls)->Apply(element_counts);
+BENCHMARK(BM_FormatHex)->Apply(element_counts);
+BENCHMARK(BM_FormatTruncated)->Apply(element_counts);
+BENCHMARK(BM_OutputStream)->Apply(element_counts);
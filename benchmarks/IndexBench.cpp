@@ -0,0 +1,79 @@
+#include "LinkedList/LinkedList.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <ranges>
+
+// Positional access with and without BlockIndex: random at(), and reading
+// a page of 50 elements starting at a random position as paginated views
+// do.
+
+namespace {
+
+constexpr std::int64_t page_size{50};
+
+void element_counts(benchmark::internal::Benchmark* benchmark) {
+    benchmark->RangeMultiplier(10)->Range(1'000, 1'000'000);
+    benchmark->Unit(benchmark::kMicrosecond);
+}
+
+template <typename List>
+void BM_At(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    List ll{std::from_range, std::views::iota(std::size_t{}, count)};
+    std::mt19937_64 generator{42};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ll.at(generator() % count));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename List>
+void BM_Page(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    List ll{std::from_range, std::views::iota(std::size_t{}, count)};
+    std::mt19937_64 generator{42};
+
+    for (auto _ : state) {
+        const auto first = generator() % (count - page_size);
+        std::size_t sum{};
+        for (const auto element : std::ranges::subrange(
+                 ll.iterator_at(first), ll.end()) |
+                 std::views::take(page_size)) {
+            sum += element;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename List>
+void BM_InsertAt(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    List ll{std::from_range, std::views::iota(std::size_t{}, count)};
+    std::mt19937_64 generator{42};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ll.insert_at(generator() % count, 0));
+        benchmark::DoNotOptimize(ll.erase_at(generator() % count));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+}
+
+BENCHMARK_TEMPLATE(BM_At, LinkedList<std::size_t>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_At, IndexedLinkedList<std::size_t>)
+    ->Apply(element_counts);
+
+BENCHMARK_TEMPLATE(BM_Page, LinkedList<std::size_t>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Page, IndexedLinkedList<std::size_t>)
+    ->Apply(element_counts);
+
+BENCHMARK_TEMPLATE(BM_InsertAt, LinkedList<std::size_t>)
+    ->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_InsertAt, IndexedLinkedList<std::size_t>)
+    ->Apply(element_counts);
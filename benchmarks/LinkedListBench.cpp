@@ -0,0 +1,263 @@
+#include "LinkedList/LinkedList.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <format>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <string>
+#include <vector>
+
+// LinkedList against the standard sequence containers. Each case only runs
+// for the containers that offer the operation cheaply: std::forward_list
+// has no push_back, std::vector no push_front.
+
+namespace {
+
+template <typename Container>
+Container make_filled(std::int64_t count) {
+    Container container{};
+    if constexpr (requires { container.push_back(0); }) {
+        for (std::int64_t i{}; i < count; ++i) {
+            container.push_back(static_cast<int>(i));
+        }
+    } else {
+        for (auto i{count}; i > 0; --i) {
+            container.push_front(static_cast<int>(i - 1));
+        }
+    }
+    return container;
+}
+
+template <typename Container>
+bool contains(const Container& container, int value) {
+    if constexpr (requires { container.contains(value); }) {
+        return container.contains(value);
+    } else {
+        return std::find(container.begin(), container.end(), value) !=
+               container.end();
+    }
+}
+
+// Removes one element from whichever end is O(1) for the container.
+template <typename Container>
+void pop(Container& container) {
+    if constexpr (requires { container.pop_front(); }) {
+        container.pop_front();
+    } else {
+        container.pop_back();
+    }
+}
+
+template <typename Container>
+void remove_all(Container& container, int value) {
+    if constexpr (requires { container.remove_all(value); }) {
+        container.remove_all(value);
+    } else if constexpr (requires { container.remove(value); }) {
+        container.remove(value);
+    } else {
+        std::erase(container, value);
+    }
+}
+
+template <typename T, typename Allocator>
+std::string format(const LinkedList<T, Allocator>& ll) {
+    return std::format("{}", ll);
+}
+
+// The standard containers are written out element by element into the same
+// "[1 -> 2 -> NULL]" text the LinkedList formatter produces.
+template <typename Container>
+std::string format(const Container& container) {
+    std::string out{"["};
+    for (const auto& element : container) {
+        std::format_to(std::back_inserter(out), "{} -> ", element);
+    }
+    out += "NULL]";
+    return out;
+}
+
+void element_counts(benchmark::internal::Benchmark* benchmark) {
+    benchmark->RangeMultiplier(10)->Range(10, 10'000'000);
+    benchmark->Unit(benchmark::kMicrosecond);
+}
+
+// Includes destroying the filled container.
+template <typename Container>
+void BM_PushFront(benchmark::State& state) {
+    const auto count = state.range(0);
+
+    for (auto _ : state) {
+        Container container{};
+        for (std::int64_t i{}; i < count; ++i) {
+            container.push_front(static_cast<int>(i));
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+// Includes destroying the filled container.
+template <typename Container>
+void BM_PushBack(benchmark::State& state) {
+    const auto count = state.range(0);
+
+    for (auto _ : state) {
+        Container container{};
+        for (std::int64_t i{}; i < count; ++i) {
+            container.push_back(static_cast<int>(i));
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <typename Container>
+void BM_Pop(benchmark::State& state) {
+    const auto count = state.range(0);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto container = make_filled<Container>(count);
+        state.ResumeTiming();
+
+        for (std::int64_t i{}; i < count; ++i) {
+            pop(container);
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+// Looks for a missing value, so every element is compared.
+template <typename Container>
+void BM_Contains(benchmark::State& state) {
+    const auto container = make_filled<Container>(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(contains(container, -1));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Removes every other element.
+template <typename Container>
+void BM_RemoveAll(benchmark::State& state) {
+    const auto count = state.range(0);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto container = make_filled<Container>(count);
+        for (auto& element : container) {
+            element %= 2;
+        }
+        state.ResumeTiming();
+
+        remove_all(container, 0);
+        benchmark::DoNotOptimize(container);
+
+        state.PauseTiming();
+        container.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+// Includes destroying the copy.
+template <typename Container>
+void BM_Copy(benchmark::State& state) {
+    const auto container = make_filled<Container>(state.range(0));
+
+    for (auto _ : state) {
+        Container copy{container};
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void BM_Clear(benchmark::State& state) {
+    const auto count = state.range(0);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto container = make_filled<Container>(count);
+        state.ResumeTiming();
+
+        container.clear();
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <typename Container>
+void BM_Iterate(benchmark::State& state) {
+    const auto container = make_filled<Container>(state.range(0));
+
+    for (auto _ : state) {
+        std::int64_t sum{};
+        for (const auto element : container) {
+            sum += element;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void BM_Format(benchmark::State& state) {
+    const auto container = make_filled<Container>(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(format(container));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}
+
+BENCHMARK_TEMPLATE(BM_PushFront, LinkedList<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_PushFront, std::forward_list<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_PushFront, std::list<int>)->Apply(element_counts);
+
+BENCHMARK_TEMPLATE(BM_PushBack, LinkedList<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_PushBack, std::list<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_PushBack, std::vector<int>)->Apply(element_counts);
+
+BENCHMARK_TEMPLATE(BM_Pop, LinkedList<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Pop, std::forward_list<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Pop, std::list<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Pop, std::vector<int>)->Apply(element_counts);
+
+BENCHMARK_TEMPLATE(BM_Contains, LinkedList<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Contains, std::forward_list<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Contains, std::list<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Contains, std::vector<int>)->Apply(element_counts);
+
+BENCHMARK_TEMPLATE(BM_RemoveAll, LinkedList<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_RemoveAll, std::forward_list<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_RemoveAll, std::list<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_RemoveAll, std::vector<int>)->Apply(element_counts);
+
+BENCHMARK_TEMPLATE(BM_Copy, LinkedList<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Copy, std::forward_list<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Copy, std::list<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Copy, std::vector<int>)->Apply(element_counts);
+
+BENCHMARK_TEMPLATE(BM_Clear, LinkedList<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Clear, std::forward_list<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Clear, std::list<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Clear, std::vector<int>)->Apply(element_counts);
+
+BENCHMARK_TEMPLATE(BM_Iterate, LinkedList<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Iterate, std::forward_list<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Iterate, std::list<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Iterate, std::vector<int>)->Apply(element_counts);
+
+BENCHMARK_TEMPLATE(BM_Format, LinkedList<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Format, std::forward_list<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Format, std::list<int>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Format, std::vector<int>)->Apply(element_counts);
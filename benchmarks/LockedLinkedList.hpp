@@ -0,0 +1,34 @@
+#pragma once
+
+#include "LinkedList/LinkedList.hpp"
+
+#include <mutex>
+#include <optional>
+
+// The baseline for the lock-free containers: a LinkedList shared behind
+// one mutex.
+template <typename T>
+class LockedLinkedList {
+    std::mutex    mutex_;
+    LinkedList<T> list_;
+
+public:
+    void push_front(T value) {
+        std::lock_guard lock{mutex_};
+        list_.push_front(std::move(value));
+    }
+
+    void push_back(T value) {
+        std::lock_guard lock{mutex_};
+        list_.push_back(std::move(value));
+    }
+
+    std::optional<T> try_pop_front() {
+        std::lock_guard lock{mutex_};
+        auto front = list_.front();
+        if (!front) return std::nullopt;
+        std::optional<T> value{std::move(front->get())};
+        list_.pop_front();
+        return value;
+    }
+};
@@ -0,0 +1,65 @@
+#include "LinkedList/LinkedList.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <ranges>
+
+// Value lookups with and without HashLookup: contains() of random values,
+// half of them present, and removing a random element and adding it back.
+// The bytes_per_element counter reports the memory_usage() of each list.
+
+namespace {
+
+void element_counts(benchmark::internal::Benchmark* benchmark) {
+    benchmark->RangeMultiplier(10)->Range(1'000, 1'000'000);
+    benchmark->Unit(benchmark::kMicrosecond);
+}
+
+template <typename List>
+void report_memory(benchmark::State& state, const List& ll) {
+    state.counters["bytes_per_element"] =
+        static_cast<double>(ll.memory_usage()) /
+        static_cast<double>(ll.size());
+}
+
+template <typename List>
+void BM_Contains(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const List ll{std::from_range, std::views::iota(std::size_t{}, count)};
+    std::mt19937_64 generator{42};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ll.contains(generator() % (2 * count)));
+    }
+    state.SetItemsProcessed(state.iterations());
+    report_memory(state, ll);
+}
+
+template <typename List>
+void BM_RemovePushBack(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    List ll{std::from_range, std::views::iota(std::size_t{}, count)};
+    std::mt19937_64 generator{42};
+
+    for (auto _ : state) {
+        const auto value = generator() % count;
+        ll.remove(value);
+        ll.push_back(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+    report_memory(state, ll);
+}
+
+}
+
+BENCHMARK_TEMPLATE(BM_Contains, LinkedList<std::size_t>)
+    ->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Contains, HashedLinkedList<std::size_t>)
+    ->Apply(element_counts);
+
+BENCHMARK_TEMPLATE(BM_RemovePushBack, LinkedList<std::size_t>)
+    ->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_RemovePushBack, HashedLinkedList<std::size_t>)
+    ->Apply(element_counts);
@@ -0,0 +1,62 @@
+#include "LinkedList/LinkedList.hpp"
+#include "LinkedList/OrderedLinkedList.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <ranges>
+
+// Lookups in OrderedLinkedList against the linear LinkedList::contains, and
+// the cost of keeping the skip list sorted on insert.
+
+namespace {
+
+void element_counts(benchmark::internal::Benchmark* benchmark) {
+    benchmark->RangeMultiplier(10)->Range(1'000, 1'000'000);
+    benchmark->Unit(benchmark::kMicrosecond);
+}
+
+void BM_LinkedListContains(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const LinkedList<std::size_t> ll{
+        std::from_range, std::views::iota(std::size_t{}, count)};
+    std::mt19937_64 generator{42};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ll.contains(generator() % (2 * count)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_OrderedContains(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    OrderedLinkedList<std::size_t> ll{};
+    std::mt19937_64 generator{42};
+    for (std::size_t i{}; i < count; ++i) ll.insert(generator() % count);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ll.contains(generator() % (2 * count)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_OrderedInsertErase(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    OrderedLinkedList<std::size_t> ll{};
+    std::mt19937_64 generator{42};
+    for (std::size_t i{}; i < count; ++i) ll.insert(generator() % count);
+
+    for (auto _ : state) {
+        const auto value = generator() % count;
+        benchmark::DoNotOptimize(ll.insert(value));
+        benchmark::DoNotOptimize(ll.erase(ll.lower_bound(value)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+}
+
+BENCHMARK(BM_LinkedListContains)->Apply(element_counts);
+BENCHMARK(BM_OrderedContains)->Apply(element_counts);
+BENCHMARK(BM_OrderedInsertErase)->Apply(element_counts);
@@ -0,0 +1,88 @@
+#include "LinkedList/LinkedList.hpp"
+#include "LinkedList/Parallel.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <ranges>
+#include <thread>
+
+// Scaling of the parallel algorithms with the number of threads. Threads
+// == 0 is the plain sequential loop.
+
+namespace {
+
+constexpr std::int64_t element_count{200'000};
+
+// A few hundred nanoseconds of arithmetic that cannot be folded away.
+double expensive(double value) {
+    for (int i{}; i < 64; ++i) {
+        value = std::sqrt(value * value + 1.0);
+    }
+    return value;
+}
+
+LinkedList<double> make_list() {
+    return LinkedList<double>{
+        std::from_range, std::views::iota(std::int64_t{}, element_count) |
+                         std::views::transform([](std::int64_t i) {
+                             return static_cast<double>(i);
+                         })};
+}
+
+void thread_counts(benchmark::internal::Benchmark* benchmark) {
+    benchmark->Arg(0);
+    const auto hardware =
+        std::max<std::int64_t>(std::thread::hardware_concurrency(), 1);
+    for (std::int64_t threads{1}; threads <= hardware; threads *= 2) {
+        benchmark->Arg(threads);
+    }
+    benchmark->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+void BM_TransformInplace(benchmark::State& state) {
+    auto ll = make_list();
+    const auto threads = static_cast<std::size_t>(state.range(0));
+    WorkStealingPool pool{std::max<std::size_t>(threads, 1)};
+
+    for (auto _ : state) {
+        if (threads == 0) {
+            std::ranges::for_each(ll, [](double& element) {
+                element = expensive(element);
+            });
+        } else {
+            parallel_transform_inplace(ll, expensive, pool);
+        }
+        benchmark::DoNotOptimize(ll);
+    }
+    state.SetItemsProcessed(state.iterations() * element_count);
+}
+
+// Cheap per-element work: bound by the walk over the nodes, which shows
+// where splitting stops paying off.
+void BM_ReduceSum(benchmark::State& state) {
+    const auto ll = make_list();
+    const auto threads = static_cast<std::size_t>(state.range(0));
+    WorkStealingPool pool{std::max<std::size_t>(threads, 1)};
+
+    for (auto _ : state) {
+        double sum{};
+        if (threads == 0) {
+            for (const auto element : ll) {
+                sum += element;
+            }
+        } else {
+            sum = parallel_reduce(ll, 0.0, std::plus<>{}, pool);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * element_count);
+}
+
+}
+
+BENCHMARK(BM_TransformInplace)->Apply(thread_counts);
+BENCHMARK(BM_ReduceSum)->Apply(thread_counts);
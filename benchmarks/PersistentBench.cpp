@@ -0,0 +1,83 @@
+#include "LinkedList/LinkedList.hpp"
+#include "LinkedList/PersistentLinkedList.hpp"
+#include "LinkedList/Serialization.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <ranges>
+#include <sstream>
+
+#include <unistd.h>
+
+// Getting a stored list back: opening a PersistentLinkedList maps its file,
+// whatever the size, while deserialize() rebuilds every node. Also the cost
+// of a commit per push_back.
+
+namespace {
+
+void element_counts(benchmark::internal::Benchmark* benchmark) {
+    benchmark->RangeMultiplier(10)->Range(1'000, 1'000'000);
+    benchmark->Unit(benchmark::kMicrosecond);
+}
+
+std::filesystem::path bench_file() {
+    return std::filesystem::temp_directory_path() /
+           std::format("PersistentBench.{}.llpersist", ::getpid());
+}
+
+void BM_PersistentOpen(benchmark::State& state) {
+    const auto count = static_cast<std::int64_t>(state.range(0));
+    const auto path = bench_file();
+    {
+        auto ll = *PersistentLinkedList<std::int64_t>::create(path);
+        for (std::int64_t i{}; i < count; ++i) ll.push_back(i);
+    }
+
+    for (auto _ : state) {
+        auto ll = PersistentLinkedList<std::int64_t>::open(
+            path, PersistentMode::ReadOnly);
+        benchmark::DoNotOptimize(ll->front());
+    }
+    std::filesystem::remove(path);
+}
+
+void BM_Deserialize(benchmark::State& state) {
+    const auto count = static_cast<std::int64_t>(state.range(0));
+    const LinkedList<std::int64_t> ll{
+        std::from_range, std::views::iota(std::int64_t{}, count)};
+    std::stringstream ss;
+    serialize(ll, ss);
+    const auto bytes = ss.str();
+
+    for (auto _ : state) {
+        auto loaded = deserialize<LinkedList<std::int64_t>>(
+            std::as_bytes(std::span{bytes}));
+        benchmark::DoNotOptimize(loaded->front());
+    }
+}
+
+void BM_PersistentPushBack(benchmark::State& state) {
+    const auto path = bench_file();
+    auto ll = *PersistentLinkedList<std::int64_t>::create(path);
+
+    std::int64_t i{};
+    for (auto _ : state) {
+        ll.push_back(i++);
+        if (ll.size() == 1'000'000) {
+            state.PauseTiming();
+            ll.clear();
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    std::filesystem::remove(path);
+}
+
+}
+
+BENCHMARK(BM_PersistentOpen)->Apply(element_counts);
+BENCHMARK(BM_Deserialize)->Apply(element_counts);
+BENCHMARK(BM_PersistentPushBack);
@@ -0,0 +1,130 @@
+#include "LinkedList/LinkedList.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+
+// Sequential against prefetching traversal over lists whose nodes are
+// scattered across the heap: the list is filled with random keys and then
+// sorted, which relinks the nodes into random address order. The larger
+// sizes do not fit into the caches, so every walk runs cold.
+
+namespace {
+
+template <typename Traversal>
+using List = LinkedList<int, std::allocator<int>, Traversal>;
+
+template <typename Traversal>
+List<Traversal> make_fragmented(std::int64_t count) {
+    std::mt19937 generator{42};
+    List<Traversal> ll{};
+    for (std::int64_t i{}; i < count; ++i) {
+        ll.push_back(static_cast<int>(generator() >> 1));
+    }
+    ll.sort();
+    return ll;
+}
+
+void element_counts(benchmark::internal::Benchmark* benchmark) {
+    benchmark->RangeMultiplier(10)->Range(10'000, 10'000'000);
+    benchmark->Unit(benchmark::kMillisecond);
+}
+
+template <typename Traversal>
+void BM_Contains(benchmark::State& state) {
+    const auto ll = make_fragmented<Traversal>(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ll.contains(-1));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Traversal>
+void BM_Copy(benchmark::State& state) {
+    const auto ll = make_fragmented<Traversal>(state.range(0));
+
+    for (auto _ : state) {
+        List<Traversal> copy{ll};
+        benchmark::DoNotOptimize(copy);
+
+        state.PauseTiming();
+        copy.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Traversal>
+void BM_Clear(benchmark::State& state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto ll = make_fragmented<Traversal>(state.range(0));
+        state.ResumeTiming();
+
+        ll.clear();
+        benchmark::DoNotOptimize(ll);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Traversal>
+void BM_RemoveAll(benchmark::State& state) {
+    auto ll = make_fragmented<Traversal>(state.range(0));
+
+    // Nothing matches, so every iteration walks the whole list.
+    for (auto _ : state) {
+        ll.remove_all(-1);
+        benchmark::DoNotOptimize(ll);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Iterate(benchmark::State& state) {
+    const auto ll = make_fragmented<SequentialTraversal>(state.range(0));
+
+    for (auto _ : state) {
+        std::int64_t sum{};
+        for (const auto element : ll) {
+            sum += element;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_IteratePrefetched(benchmark::State& state) {
+    const auto ll = make_fragmented<SequentialTraversal>(state.range(0));
+
+    for (auto _ : state) {
+        std::int64_t sum{};
+        for (const auto element : prefetched(ll)) {
+            sum += element;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}
+
+BENCHMARK_TEMPLATE(BM_Contains, SequentialTraversal)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Contains, PrefetchTraversal<4>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Contains, PrefetchTraversal<8>)->Apply(element_counts);
+
+BENCHMARK_TEMPLATE(BM_Copy, SequentialTraversal)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Copy, PrefetchTraversal<4>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Copy, PrefetchTraversal<8>)->Apply(element_counts);
+
+BENCHMARK_TEMPLATE(BM_Clear, SequentialTraversal)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Clear, PrefetchTraversal<4>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Clear, PrefetchTraversal<8>)->Apply(element_counts);
+
+BENCHMARK_TEMPLATE(BM_RemoveAll, SequentialTraversal)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_RemoveAll, PrefetchTraversal<4>)->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_RemoveAll, PrefetchTraversal<8>)->Apply(element_counts);
+
+BENCHMARK(BM_Iterate)->Apply(element_counts);
+BENCHMARK(BM_IteratePrefetched)->Apply(element_counts);
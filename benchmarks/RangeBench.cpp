@@ -0,0 +1,113 @@
+#include "LinkedList/LinkedList.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+// Bulk loading through the range constructor, which allocates the nodes
+// back to back, and through append_range() after reserve(), which takes
+// them from one block, against pushing the elements one by one.
+
+namespace {
+
+std::vector<int> make_values(std::int64_t count) {
+    std::vector<int> values(static_cast<std::size_t>(count));
+    std::iota(values.begin(), values.end(), 0);
+    return values;
+}
+
+void element_counts(benchmark::internal::Benchmark* benchmark) {
+    benchmark->RangeMultiplier(10)->Range(1'000, 10'000'000);
+    benchmark->Unit(benchmark::kMicrosecond);
+}
+
+// Includes destroying the list.
+void BM_LoadPushBack(benchmark::State& state) {
+    const auto values = make_values(state.range(0));
+
+    for (auto _ : state) {
+        LinkedList<int> ll{};
+        for (const auto value : values) {
+            ll.push_back(value);
+        }
+        benchmark::DoNotOptimize(ll);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Includes destroying the list.
+void BM_LoadFromRange(benchmark::State& state) {
+    const auto values = make_values(state.range(0));
+
+    for (auto _ : state) {
+        LinkedList<int> ll(std::from_range, values);
+        benchmark::DoNotOptimize(ll);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Includes destroying the list.
+void BM_LoadReservedFromRange(benchmark::State& state) {
+    const auto values = make_values(state.range(0));
+
+    for (auto _ : state) {
+        LinkedList<int> ll{};
+        ll.reserve(values.size());
+        ll.append_range(values);
+        benchmark::DoNotOptimize(ll);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// First walk over a list built by push_back while other allocations were
+// interleaved with its nodes.
+void BM_IterateAfterPushBack(benchmark::State& state) {
+    const auto values = make_values(state.range(0));
+
+    std::vector<std::unique_ptr<int>> noise;
+    LinkedList<int> ll{};
+    for (const auto value : values) {
+        ll.push_back(value);
+        noise.push_back(std::make_unique<int>(value));
+    }
+
+    for (auto _ : state) {
+        std::int64_t sum{};
+        for (const auto element : ll) {
+            sum += element;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_IterateAfterLoadFromRange(benchmark::State& state) {
+    const auto values = make_values(state.range(0));
+
+    std::vector<std::unique_ptr<int>> noise;
+    for (const auto value : values) {
+        noise.push_back(std::make_unique<int>(value));
+    }
+    const LinkedList<int> ll(std::from_range, values);
+
+    for (auto _ : state) {
+        std::int64_t sum{};
+        for (const auto element : ll) {
+            sum += element;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}
+
+BENCHMARK(BM_LoadPushBack)->Apply(element_counts);
+BENCHMARK(BM_LoadFromRange)->Apply(element_counts);
+BENCHMARK(BM_LoadReservedFromRange)->Apply(element_counts);
+
+BENCHMARK(BM_IterateAfterPushBack)->Apply(element_counts);
+BENCHMARK(BM_IterateAfterLoadFromRange)->Apply(element_counts);
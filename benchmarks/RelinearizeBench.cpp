@@ -0,0 +1,88 @@
+#include "LinkedList/LinkedList.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+// Iteration over a list whose nodes were scattered by churn, before and
+// after relinearize(), and the cost of relinearize() itself.
+
+namespace {
+
+// Builds a list of `count` elements by pushing to both ends while
+// unrelated allocations come and go, then rotates half of it through
+// pop_front/push_back so that neighbours in the list are far apart.
+LinkedList<int> make_churned(std::int64_t count) {
+    std::mt19937 generator{42};
+    std::vector<std::unique_ptr<int>> noise;
+
+    LinkedList<int> ll{};
+    for (std::int64_t i{}; i < count; ++i) {
+        if (generator() % 2) {
+            ll.push_front(static_cast<int>(i));
+        } else {
+            ll.push_back(static_cast<int>(i));
+        }
+        noise.push_back(std::make_unique<int>(0));
+        if (generator() % 4 == 0) {
+            noise[generator() % noise.size()].reset();
+        }
+    }
+    for (std::int64_t i{}; i < count / 2; ++i) {
+        const auto front = *ll.front();
+        ll.pop_front();
+        noise.push_back(std::make_unique<int>(0));
+        ll.push_back(front);
+    }
+    return ll;
+}
+
+void element_counts(benchmark::internal::Benchmark* benchmark) {
+    benchmark->RangeMultiplier(10)->Range(10'000, 10'000'000);
+    benchmark->Unit(benchmark::kMicrosecond);
+}
+
+template <bool Relinearized>
+void BM_Iterate(benchmark::State& state) {
+    auto ll = make_churned(state.range(0));
+    if constexpr (Relinearized) {
+        ll.relinearize();
+    }
+
+    for (auto _ : state) {
+        std::int64_t sum{};
+        for (const auto element : ll) {
+            sum += element;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Relinearize(benchmark::State& state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto ll = make_churned(state.range(0));
+        state.ResumeTiming();
+
+        ll.relinearize();
+        benchmark::DoNotOptimize(ll);
+
+        state.PauseTiming();
+        ll.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}
+
+BENCHMARK_TEMPLATE(BM_Iterate, false)
+    ->Name("BM_IterateChurned")->Apply(element_counts);
+BENCHMARK_TEMPLATE(BM_Iterate, true)
+    ->Name("BM_IterateRelinearized")->Apply(element_counts);
+
+BENCHMARK(BM_Relinearize)->Apply(element_counts);
@@ -0,0 +1,108 @@
+#include "LinkedList/LinkedList.hpp"
+#include "LinkedList/Serialization.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <spanstream>
+#include <string>
+#include <vector>
+
+// Serialization throughput in bytes of serialized data per second: the bulk
+// encoding into a buffer and through a stream, and the per-element encoding
+// of strings.
+
+namespace {
+
+constexpr std::int64_t element_count{1'000'000};
+
+LinkedList<std::uint64_t> make_list() {
+    return LinkedList<std::uint64_t>{
+        std::from_range,
+        std::views::iota(std::uint64_t{},
+                         static_cast<std::uint64_t>(element_count))};
+}
+
+LinkedList<std::string> make_strings() {
+    return LinkedList<std::string>{
+        std::from_range,
+        std::views::iota(std::int64_t{}, element_count / 10) |
+            std::views::transform([](std::int64_t i) {
+                return std::string(static_cast<std::size_t>(16 + i % 32),
+                                   'x');
+            })};
+}
+
+template <typename T>
+void BM_SerializeToBuffer(benchmark::State& state, LinkedList<T> ll) {
+    std::vector<std::byte> buffer(serialized_size(ll));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(serialize(ll, std::span{buffer}));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<std::int64_t>(buffer.size()));
+}
+
+template <typename T>
+void BM_DeserializeFromBuffer(benchmark::State& state, LinkedList<T> ll) {
+    std::vector<std::byte> buffer(serialized_size(ll));
+    if (!serialize(ll, std::span{buffer})) {
+        state.SkipWithError("serialize failed");
+        return;
+    }
+
+    for (auto _ : state) {
+        auto loaded =
+            deserialize<LinkedList<T>>(std::span{std::as_const(buffer)});
+        benchmark::DoNotOptimize(loaded);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<std::int64_t>(buffer.size()));
+}
+
+void BM_SerializeToStream(benchmark::State& state) {
+    const auto ll = make_list();
+    std::vector<char> buffer(serialized_size(ll));
+
+    for (auto _ : state) {
+        std::ospanstream os{std::span{buffer}};
+        benchmark::DoNotOptimize(serialize(ll, os));
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<std::int64_t>(buffer.size()));
+}
+
+void BM_DeserializeFromStream(benchmark::State& state) {
+    const auto ll = make_list();
+    std::vector<char> buffer(serialized_size(ll));
+    std::ospanstream os{std::span{buffer}};
+    if (!serialize(ll, os)) {
+        state.SkipWithError("serialize failed");
+        return;
+    }
+
+    for (auto _ : state) {
+        std::ispanstream is{std::span<const char>{buffer}};
+        auto loaded = deserialize<LinkedList<std::uint64_t>>(is);
+        benchmark::DoNotOptimize(loaded);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<std::int64_t>(buffer.size()));
+}
+
+}
+
+BENCHMARK_CAPTURE(BM_SerializeToBuffer, bulk, make_list())
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_DeserializeFromBuffer, bulk, make_list())
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SerializeToStream)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DeserializeFromStream)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_SerializeToBuffer, strings, make_strings())
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_DeserializeFromBuffer, strings, make_strings())
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,124 @@
+#include "LinkedList/LinkedList.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <forward_list>
+#include <random>
+#include <vector>
+
+namespace {
+
+std::vector<int> random_values(std::size_t count) {
+    std::mt19937 generator{42};
+    std::vector<int> values(count);
+    std::ranges::generate(values, generator);
+    return values;
+}
+
+void BM_LinkedListSort(benchmark::State& state) {
+    const auto values = random_values(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        LinkedList<int> ll{};
+        for (const auto value : values) {
+            ll.push_back(value);
+        }
+        state.ResumeTiming();
+
+        ll.sort();
+        benchmark::DoNotOptimize(ll.front());
+
+        state.PauseTiming();
+        ll.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ForwardListSort(benchmark::State& state) {
+    const auto values = random_values(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::forward_list<int> fl(values.begin(), values.end());
+        state.ResumeTiming();
+
+        fl.sort();
+        benchmark::DoNotOptimize(fl.front());
+
+        state.PauseTiming();
+        fl.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// What callers did before LinkedList::sort: copy out, sort, rebuild.
+void BM_LinkedListVectorSortRebuild(benchmark::State& state) {
+    const auto values = random_values(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        LinkedList<int> ll{};
+        for (const auto value : values) {
+            ll.push_back(value);
+        }
+        state.ResumeTiming();
+
+        std::vector<int> copy(ll.begin(), ll.end());
+        std::ranges::stable_sort(copy);
+        ll.clear();
+        for (const auto value : copy) {
+            ll.push_back(value);
+        }
+        benchmark::DoNotOptimize(ll.front());
+
+        state.PauseTiming();
+        ll.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_LinkedListMerge(benchmark::State& state) {
+    const auto count = state.range(0);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        LinkedList<int> evens{};
+        LinkedList<int> odds{};
+        for (int i{}; i < count; i += 2) {
+            evens.push_back(i);
+            odds.push_back(i + 1);
+        }
+        state.ResumeTiming();
+
+        evens.merge(std::move(odds));
+        benchmark::DoNotOptimize(evens.back());
+
+        state.PauseTiming();
+        evens.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+}
+
+BENCHMARK(BM_LinkedListSort)
+    ->RangeMultiplier(10)->Range(10'000, 10'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_ForwardListSort)
+    ->RangeMultiplier(10)->Range(10'000, 10'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_LinkedListVectorSortRebuild)
+    ->RangeMultiplier(10)->Range(10'000, 10'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_LinkedListMerge)
+    ->RangeMultiplier(10)->Range(10'000, 10'000'000)
+    ->Unit(benchmark::kMillisecond);
@@ -1,3 +1,3 @@
 #! /usr/bin/bash
 
-rm -rf build
+rm -rf build build-release
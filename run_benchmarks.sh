@@ -0,0 +1,14 @@
+#! /usr/bin/env bash
+
+# Builds the benchmarks in Release and stores the results as JSON, so runs of
+# different versions can be compared (e.g. with benchmark's compare.py).
+# Extra arguments are passed on, e.g. --benchmark_filter=BM_Push.
+
+out="${BENCHMARK_OUT:-benchmark_results.json}"
+
+[ ! -d build-release ] && mkdir -p build-release
+
+cmake -S . -B build-release -DCMAKE_BUILD_TYPE=Release -DBUILD_BENCHMARKS=ON \
+    && cmake --build build-release --target LinkedListBench \
+    && ./build-release/benchmarks/LinkedListBench \
+        --benchmark_out="$out" --benchmark_out_format=json "$@"
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "LinkedList/LinkedList.hpp"
+#include "LinkedList/HazardPointer.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+
+// Node<T> with an atomic link, as the Michael-Scott queue updates `next`
+// of nodes that other threads are traversing.
+template <typename T>
+struct ConcurrentNode {
+    // Alive only while the node carries a queued element; the dummy node at
+    // the head never does.
+    union {
+        T data;
+    };
+    std::atomic<ConcurrentNode*> next{};
+
+    ConcurrentNode() {}
+
+    template <typename... Args>
+    explicit ConcurrentNode(std::in_place_t, Args&&... args)
+        : data(std::forward<Args>(args)...) {}
+
+    ~ConcurrentNode() {}
+
+    ConcurrentNode(const ConcurrentNode&)            = delete;
+    ConcurrentNode& operator=(const ConcurrentNode&) = delete;
+};
+
+// Lock-free multi-producer multi-consumer FIFO queue (Michael & Scott).
+// head_ always points to a dummy node; the front element lives in the node
+// after it. Dequeued nodes are reclaimed through hazard pointers.
+template <typename T>
+class ConcurrentLinkedQueue {
+    using node         = ConcurrentNode<T>;
+    using node_pointer = node*;
+
+    std::atomic<node_pointer> head_;
+    std::atomic<node_pointer> tail_;
+
+public:
+    using value_type      = T;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+
+    ConcurrentLinkedQueue() {
+        const auto dummy = new node{};
+        head_.store(dummy, std::memory_order_relaxed);
+        tail_.store(dummy, std::memory_order_relaxed);
+    }
+
+    ConcurrentLinkedQueue(const ConcurrentLinkedQueue&)            = delete;
+    ConcurrentLinkedQueue& operator=(const ConcurrentLinkedQueue&) = delete;
+
+    // Must not run concurrently with any other member function.
+    ~ConcurrentLinkedQueue() {
+        auto current = head_.load(std::memory_order_acquire);
+        auto next    = current->next.load(std::memory_order_relaxed);
+        delete current;
+        for (current = next; current; current = next) {
+            next = current->next.load(std::memory_order_relaxed);
+            std::destroy_at(&current->data);
+            delete current;
+        }
+    }
+
+    // Only a snapshot when other threads are modifying the queue.
+    [[nodiscard]]
+    bool is_empty() const {
+        hazard::HazardPointer hp;
+        const auto head = hp.protect(head_);
+        return head->next.load(std::memory_order_acquire) == nullptr;
+    }
+
+    void push_back(value_type data) { emplace_back(std::move(data)); }
+
+    template <typename... Args>
+    void emplace_back(Args&&... args) {
+        const auto new_node =
+            new node{std::in_place, std::forward<Args>(args)...};
+
+        hazard::HazardPointer hp;
+        for (;;) {
+            auto tail = hp.protect(tail_);
+            auto next = tail->next.load(std::memory_order_acquire);
+            if (tail != tail_.load(std::memory_order_acquire)) continue;
+
+            if (next) {
+                // Tail is lagging behind; help the other enqueuer.
+                tail_.compare_exchange_weak(
+                    tail, next,
+                    std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+            if (tail->next.compare_exchange_weak(
+                    next, new_node,
+                    std::memory_order_release, std::memory_order_relaxed)) {
+                tail_.compare_exchange_strong(
+                    tail, new_node,
+                    std::memory_order_release, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+    [[nodiscard]]
+    std::optional<value_type> try_pop_front() {
+        hazard::HazardPointer hp_head;
+        hazard::HazardPointer hp_next;
+
+        for (;;) {
+            auto head = hp_head.protect(head_);
+            const auto next = hp_next.protect(head->next);
+            if (head != head_.load(std::memory_order_acquire)) continue;
+            if (!next) return std::nullopt;
+
+            auto tail = tail_.load(std::memory_order_acquire);
+            if (head == tail) {
+                // An enqueue linked `next` but has not swung the tail yet.
+                tail_.compare_exchange_weak(
+                    tail, next,
+                    std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+
+            // Release so that later dequeuers reading the new head also see
+            // the enqueue that published it.
+            if (head_.compare_exchange_weak(
+                    head, next,
+                    std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                // `next` is the new dummy; only the winner of the
+                // compare-exchange touches its element.
+                std::optional<value_type> result;
+                try {
+                    result.emplace(std::move(next->data));
+                } catch (...) {
+                    // The element is lost, but the old dummy is unlinked
+                    // and has to be reclaimed all the same.
+                    std::destroy_at(&next->data);
+                    hp_head.reset();
+                    hazard::retire(head);
+                    throw;
+                }
+                std::destroy_at(&next->data);
+                hp_head.reset();
+                hazard::retire(head);
+                return result;
+            }
+        }
+    }
+
+    // Moves up to `max_count` elements to the back of `out`, stopping early
+    // when the queue runs empty. Returns how many elements were moved.
+    template <typename... Ts>
+    std::size_t pop_front_into(LinkedList<T, Ts...>& out,
+                               std::size_t max_count) {
+        std::size_t count{};
+        for (; count < max_count; ++count) {
+            auto element = try_pop_front();
+            if (!element) break;
+            out.push_back(std::move(*element));
+        }
+        return count;
+    }
+};
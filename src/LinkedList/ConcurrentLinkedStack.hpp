@@ -0,0 +1,114 @@
+#pragma once
+
+#include "LinkedList/LinkedList.hpp"
+#include "LinkedList/HazardPointer.hpp"
+
+#include <atomic>
+#include <optional>
+#include <ranges>
+#include <utility>
+
+// Lock-free LIFO stack (Treiber stack) built from the same Node<T> as
+// LinkedList. Any number of threads may push and pop at the same time.
+// Popped nodes are reclaimed through hazard pointers, which also protects
+// the compare-exchange on the head against ABA.
+template <typename T>
+class ConcurrentLinkedStack {
+    using node         = Node<T>;
+    using node_pointer = node*;
+
+    std::atomic<node_pointer> head_{};
+
+    // Publishes the already linked chain [first, last] on top of the stack.
+    void link_chain(node_pointer first, node_pointer last) {
+        last->next = head_.load(std::memory_order_relaxed);
+        while (!head_.compare_exchange_weak(
+                last->next, first,
+                std::memory_order_release, std::memory_order_relaxed));
+    }
+
+public:
+    using value_type      = T;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+
+    constexpr ConcurrentLinkedStack() = default;
+
+    ConcurrentLinkedStack(const ConcurrentLinkedStack&)            = delete;
+    ConcurrentLinkedStack& operator=(const ConcurrentLinkedStack&) = delete;
+
+    // Must not run concurrently with any other member function.
+    ~ConcurrentLinkedStack() {
+        for (auto current{head_.load(std::memory_order_acquire)}; current;) {
+            const auto next = current->next;
+            delete current;
+            current = next;
+        }
+    }
+
+    // Only a snapshot when other threads are modifying the stack.
+    [[nodiscard]]
+    bool is_empty() const {
+        return head_.load(std::memory_order_acquire) == nullptr;
+    }
+
+    void push_front(value_type data) { emplace_front(std::move(data)); }
+
+    template <typename... Args>
+    void emplace_front(Args&&... args) {
+        const auto new_node =
+            new node{std::in_place, nullptr, std::forward<Args>(args)...};
+        link_chain(new_node, new_node);
+    }
+
+    // Pushes every element of `range` as if by push_front in order, so the
+    // last element ends up on top, but makes them visible with one
+    // compare-exchange.
+    template <std::ranges::input_range R>
+    void push_range(R&& range) {
+        node_pointer first{nullptr};
+        node_pointer last{nullptr};
+        try {
+            for (auto&& element : range) {
+                first = new node{std::in_place, first,
+                                 std::forward<decltype(element)>(element)};
+                if (!last) last = first;
+            }
+        } catch (...) {
+            while (first) {
+                delete std::exchange(first, first->next);
+            }
+            throw;
+        }
+
+        if (first) link_chain(first, last);
+    }
+
+    [[nodiscard]]
+    std::optional<value_type> try_pop_front() {
+        hazard::HazardPointer hp;
+
+        node_pointer top{};
+        do {
+            top = hp.protect(head_);
+            if (!top) return std::nullopt;
+        } while (!head_.compare_exchange_weak(
+                    top, top->next,
+                    std::memory_order_acquire, std::memory_order_relaxed));
+        hp.reset();
+
+        // Other threads may still read top->next, but only the winner of
+        // the compare-exchange touches the data.
+        std::optional<value_type> result;
+        try {
+            result.emplace(std::move(top->data));
+        } catch (...) {
+            // The element is lost, but its node is unlinked and has to be
+            // reclaimed all the same.
+            hazard::retire(top);
+            throw;
+        }
+        hazard::retire(top);
+        return result;
+    }
+};
@@ -0,0 +1,501 @@
+#pragma once
+
+#include "LinkedList/LinkedList.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <format>
+#include <ostream>
+#include <expected>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+// Links of a DoublyNode. The list's sentinel is a bare DoublyNodeLinks, so
+// it carries no element.
+struct DoublyNodeLinks {
+    DoublyNodeLinks* prev{};
+    DoublyNodeLinks* next{};
+};
+
+template <typename T>
+struct DoublyNode : DoublyNodeLinks {
+    T data;
+
+    template <typename... Args>
+    explicit constexpr DoublyNode(std::in_place_t, Args&&... args)
+        : data(std::forward<Args>(args)...) {}
+};
+
+template <typename T>
+class DoublyLinkedListIterator {
+    using links_pointer = DoublyNodeLinks*;
+    using node_pointer  = DoublyNode<std::remove_const_t<T>>*;
+
+    links_pointer current_;
+
+    template <typename, typename>
+    friend class DoublyLinkedList;
+
+    template <typename>
+    friend class DoublyLinkedListIterator;
+
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type        = std::remove_const_t<T>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = T*;
+    using reference         = T&;
+
+    constexpr DoublyLinkedListIterator() : current_{nullptr} {}
+
+    explicit constexpr DoublyLinkedListIterator(links_pointer current)
+        : current_(current) {}
+
+    // iterator -> const_iterator
+    template <typename U>
+        requires (std::is_const_v<T> && std::is_same_v<const U, T>)
+    constexpr DoublyLinkedListIterator(const DoublyLinkedListIterator<U>& other)
+        : current_(other.current_) {}
+
+    constexpr T& operator*() const {
+        return static_cast<node_pointer>(current_)->data;
+    }
+
+    constexpr T* operator->() const { return &**this; }
+
+    constexpr DoublyLinkedListIterator& operator++() {
+        current_ = current_->next;
+        return *this;
+    }
+
+    constexpr DoublyLinkedListIterator operator++(int) {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    constexpr DoublyLinkedListIterator& operator--() {
+        current_ = current_->prev;
+        return *this;
+    }
+
+    constexpr DoublyLinkedListIterator operator--(int) {
+        auto tmp = *this;
+        --*this;
+        return tmp;
+    }
+
+    friend constexpr bool operator==(const DoublyLinkedListIterator& lhs,
+                                     const DoublyLinkedListIterator& rhs) {
+        return lhs.current_ == rhs.current_;
+    }
+};
+
+// Doubly linked sibling of LinkedList: O(1) insertion and removal at both
+// ends and at any iterator, and bidirectional iterators, at the price of
+// one more pointer per node.
+//
+// The nodes form a ring through a sentinel that lives in the list object;
+// end() points to the sentinel, so --end() is the last element.
+template <typename T, typename Allocator = std::allocator<T>>
+class DoublyLinkedList {
+    using node          = DoublyNode<T>;
+    using node_pointer  = node*;
+    using links_pointer = DoublyNodeLinks*;
+
+    using allocator_traits = std::allocator_traits<Allocator>;
+    using node_allocator   =
+        typename allocator_traits::template rebind_alloc<node>;
+    using node_traits      = std::allocator_traits<node_allocator>;
+
+    static_assert(std::is_same_v<typename node_traits::pointer, node_pointer>,
+        "DoublyLinkedList supports only allocators with raw pointers");
+
+    DoublyNodeLinks head_;
+    std::size_t     size_{};
+
+    [[no_unique_address]] node_allocator alloc_{};
+
+    [[nodiscard]]
+    static constexpr node_pointer as_node(links_pointer links) {
+        return static_cast<node_pointer>(links);
+    }
+
+    [[nodiscard]]
+    constexpr links_pointer sentinel() const {
+        return const_cast<links_pointer>(&head_);
+    }
+
+    constexpr void reset() {
+        head_.prev = head_.next = &head_;
+        size_ = 0;
+    }
+
+    template <typename... Args>
+    constexpr node_pointer create_node(Args&&... args) {
+        const auto new_node = node_traits::allocate(alloc_, 1);
+        try {
+            node_traits::construct(
+                alloc_, new_node, std::in_place, std::forward<Args>(args)...);
+        } catch (...) {
+            node_traits::deallocate(alloc_, new_node, 1);
+            throw;
+        }
+        return new_node;
+    }
+
+    constexpr void destroy_node(links_pointer links) {
+        const auto n = as_node(links);
+        node_traits::destroy(alloc_, n);
+        node_traits::deallocate(alloc_, n, 1);
+    }
+
+    static constexpr void link_before(links_pointer position,
+                                      links_pointer links) {
+        links->next = position;
+        links->prev = position->prev;
+        position->prev->next = links;
+        position->prev       = links;
+    }
+
+    static constexpr void unlink(links_pointer links) {
+        links->prev->next = links->next;
+        links->next->prev = links->prev;
+    }
+
+    // Makes `other`'s nodes this list's; this list must be empty.
+    constexpr void steal_from(DoublyLinkedList& other) noexcept {
+        if (other.is_empty()) return;
+
+        head_.next = other.head_.next;
+        head_.prev = other.head_.prev;
+        head_.next->prev = &head_;
+        head_.prev->next = &head_;
+        size_ = other.size_;
+        other.reset();
+    }
+
+    constexpr void copy_from(const DoublyLinkedList& other) {
+        for (const auto& element : other) {
+            emplace_back(element);
+        }
+    }
+
+    constexpr void move_elements_from(DoublyLinkedList& other) {
+        for (auto& element : other) {
+            emplace_back(std::move(element));
+        }
+        other.clear();
+    }
+
+    friend struct std::formatter<DoublyLinkedList>;
+
+public:
+    using value_type      = T;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+
+    using allocator_type  = Allocator;
+
+    using iterator               = DoublyLinkedListIterator<T>;
+    using const_iterator         = DoublyLinkedListIterator<const T>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    constexpr DoublyLinkedList() { reset(); }
+
+    explicit constexpr DoublyLinkedList(const Allocator& alloc)
+            : alloc_{alloc} {
+        reset();
+    }
+
+    explicit constexpr DoublyLinkedList(T data,
+                                        const Allocator& alloc = Allocator())
+            : DoublyLinkedList(alloc) {
+        push_back(std::move(data));
+    }
+
+    explicit constexpr DoublyLinkedList(std::initializer_list<T> elements,
+                                        const Allocator& alloc = Allocator())
+            : DoublyLinkedList(alloc) {
+        try {
+            for (const auto& element : elements) {
+                emplace_back(element);
+            }
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+    constexpr DoublyLinkedList(const DoublyLinkedList& other)
+        : DoublyLinkedList(
+              other, node_traits::select_on_container_copy_construction(
+                         other.alloc_)) {}
+
+    constexpr DoublyLinkedList(const DoublyLinkedList& other,
+                               const Allocator& alloc)
+            : DoublyLinkedList(alloc) {
+        try {
+            copy_from(other);
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+    constexpr DoublyLinkedList& operator=(const DoublyLinkedList& other) {
+        if (this == &other) return *this;
+
+        clear();
+        if constexpr (
+                node_traits::propagate_on_container_copy_assignment::value) {
+            alloc_ = other.alloc_;
+        }
+        copy_from(other);
+        return *this;
+    }
+
+    constexpr DoublyLinkedList(DoublyLinkedList&& other) noexcept
+            : alloc_{std::move(other.alloc_)} {
+        reset();
+        steal_from(other);
+    }
+
+    constexpr DoublyLinkedList(DoublyLinkedList&& other,
+                               const Allocator& alloc)
+            : DoublyLinkedList(alloc) {
+        if (alloc_ == other.alloc_) {
+            steal_from(other);
+        } else {
+            move_elements_from(other);
+        }
+    }
+
+    constexpr DoublyLinkedList& operator=(DoublyLinkedList&& other) noexcept(
+            node_traits::propagate_on_container_move_assignment::value ||
+            node_traits::is_always_equal::value) {
+        if (this == &other) return *this;
+
+        clear();
+        if constexpr (
+                node_traits::propagate_on_container_move_assignment::value) {
+            alloc_ = std::move(other.alloc_);
+            steal_from(other);
+        } else if (alloc_ == other.alloc_) {
+            steal_from(other);
+        } else {
+            move_elements_from(other);
+        }
+        return *this;
+    }
+
+    constexpr ~DoublyLinkedList() { clear(); }
+
+    [[nodiscard]]
+    constexpr allocator_type get_allocator() const {
+        return allocator_type(alloc_);
+    }
+
+    constexpr void clear() {
+        for (auto current{head_.next}; current != &head_;) {
+            const auto next = current->next;
+            destroy_node(current);
+            current = next;
+        }
+        reset();
+    }
+
+    // As for the standard containers, swapping lists whose allocators
+    // neither propagate nor compare equal is undefined behaviour.
+    friend constexpr void swap(DoublyLinkedList& l1,
+                               DoublyLinkedList& l2) noexcept {
+        if constexpr (node_traits::propagate_on_container_swap::value) {
+            using std::swap;
+            swap(l1.alloc_, l2.alloc_);
+        }
+        DoublyLinkedList tmp(l1.get_allocator());
+        tmp.steal_from(l1);
+        l1.steal_from(l2);
+        l2.steal_from(tmp);
+    }
+
+    [[nodiscard]]
+    constexpr std::size_t size() const { return size_; };
+
+    [[nodiscard]]
+    constexpr auto begin() { return iterator{head_.next}; }
+
+    [[nodiscard]]
+    constexpr auto end() { return iterator{sentinel()}; }
+
+    [[nodiscard]]
+    constexpr auto begin() const { return const_iterator{head_.next}; }
+
+    [[nodiscard]]
+    constexpr auto end() const { return const_iterator{sentinel()}; }
+
+    [[nodiscard]]
+    constexpr auto cbegin() const { return begin(); }
+
+    [[nodiscard]]
+    constexpr auto cend() const { return end(); }
+
+    [[nodiscard]]
+    constexpr auto rbegin() { return reverse_iterator{end()}; }
+
+    [[nodiscard]]
+    constexpr auto rend() { return reverse_iterator{begin()}; }
+
+    [[nodiscard]]
+    constexpr auto rbegin() const { return const_reverse_iterator{end()}; }
+
+    [[nodiscard]]
+    constexpr auto rend() const { return const_reverse_iterator{begin()}; }
+
+    [[nodiscard]]
+    constexpr auto is_empty() const { return size_ == 0; }
+
+    [[nodiscard]]
+    constexpr auto contains(const_reference value) const {
+        return std::find(begin(), end(), value) != end();
+    }
+
+    [[nodiscard]]
+    std::expected<std::reference_wrapper<value_type>, LinkedListError>
+    front() {
+        if (is_empty()) return std::unexpected(LinkedListError::EmptyList);
+        return as_node(head_.next)->data;
+    }
+
+    [[nodiscard]]
+    std::expected<std::reference_wrapper<const value_type>, LinkedListError>
+    front() const {
+        if (is_empty()) return std::unexpected(LinkedListError::EmptyList);
+        return as_node(head_.next)->data;
+    }
+
+    [[nodiscard]]
+    std::expected<std::reference_wrapper<value_type>, LinkedListError>
+    back() {
+        if (is_empty()) return std::unexpected(LinkedListError::EmptyList);
+        return as_node(head_.prev)->data;
+    }
+
+    [[nodiscard]]
+    std::expected<std::reference_wrapper<const value_type>, LinkedListError>
+    back() const {
+        if (is_empty()) return std::unexpected(LinkedListError::EmptyList);
+        return as_node(head_.prev)->data;
+    }
+
+    // Constructs a new element right before `pos`, which may be end().
+    template <typename... Args>
+    constexpr iterator emplace(const_iterator pos, Args&&... args) {
+        const auto new_node = create_node(std::forward<Args>(args)...);
+        link_before(pos.current_, new_node);
+        ++size_;
+        return iterator{new_node};
+    }
+
+    constexpr iterator insert(const_iterator pos, value_type data) {
+        return emplace(pos, std::move(data));
+    }
+
+    constexpr void push_front(value_type data) {
+        emplace_front(std::move(data));
+    }
+
+    template <typename... Args>
+    constexpr reference emplace_front(Args&&... args) {
+        return *emplace(begin(), std::forward<Args>(args)...);
+    }
+
+    constexpr void push_back(value_type data) {
+        emplace_back(std::move(data));
+    }
+
+    template <typename... Args>
+    constexpr reference emplace_back(Args&&... args) {
+        return *emplace(end(), std::forward<Args>(args)...);
+    }
+
+    // Removes the element at `pos` and returns the position after it.
+    constexpr iterator erase(const_iterator pos) {
+        const auto next = pos.current_->next;
+        unlink(pos.current_);
+        destroy_node(pos.current_);
+        --size_;
+        return iterator{next};
+    }
+
+    constexpr void pop_front() {
+        if (!is_empty()) erase(begin());
+    }
+
+    constexpr void pop_back() {
+        if (!is_empty()) erase(--end());
+    }
+
+    // Moves the element at `it` of `other`, which may be this list, right
+    // before `pos` without copying or allocating, e.g. to move a used
+    // entry of an LRU list to the front. The allocators must compare equal.
+    constexpr void splice(const_iterator pos, DoublyLinkedList& other,
+                          const_iterator it) {
+        if (pos == it || pos.current_ == it.current_->next) return;
+
+        unlink(it.current_);
+        link_before(pos.current_, it.current_);
+        if (&other != this) {
+            --other.size_;
+            ++size_;
+        }
+    }
+
+    constexpr void splice(const_iterator pos, DoublyLinkedList&& other,
+                          const_iterator it) {
+        splice(pos, other, it);
+    }
+
+    friend constexpr bool operator==(
+            const DoublyLinkedList& lhs, const DoublyLinkedList& rhs) {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    friend std::ostream& operator<<(
+            std::ostream& os, const DoublyLinkedList& ll) {
+        os << "[";
+        std::for_each(std::begin(ll), std::end(ll), [&os](const auto& element) {
+            os << element << " -> "; });
+        os << "NULL]";
+        return os;
+    };
+
+    constexpr void remove(const_reference data) {
+        const auto it = std::find(cbegin(), cend(), data);
+        if (it != cend()) erase(it);
+    }
+
+    constexpr void remove_all(const_reference data) {
+        for (auto it{cbegin()}; it != cend();) {
+            if (*it == data) {
+                it = erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+};
+
+namespace pmr {
+template <typename T>
+using DoublyLinkedList =
+    ::DoublyLinkedList<T, std::pmr::polymorphic_allocator<T>>;
+}
+
+template <typename T, typename Allocator>
+struct std::formatter<DoublyLinkedList<T, Allocator>>
+    : LinkedListFormatter<T> {};
@@ -0,0 +1,236 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+// Value lookup policies for LinkedList.
+//
+// NoLookup keeps nothing: contains(), count(), remove() and remove_all()
+// walk the list.
+// HashLookup<Key, Hash> keeps a hash table from the hash of every element's
+// key to the node before it, which makes those operations average O(1) per
+// match: a lookup only compares the elements whose key hashes alike, and
+// the node before a match is at hand to unlink it. Key projects an element
+// to the part that is hashed (the element itself by default); elements that
+// compare equal must have equal keys. Hash defaults to std::hash of the key.
+//
+// Unlike the positional index, the table is never left stale: push/pop,
+// insertion and erasure update it in O(1), splicing in O(moved elements)
+// and the operations that relink the whole list (sort, merge, ...) rebuild
+// it in O(n). If such a rebuild throws, the table is dropped rather than
+// left stale: contains() and count() walk the list until remove() or
+// remove_all() builds it again. The table cannot see elements changed in
+// place through iterators or references; changing an element's key that
+// way leaves it unfindable until the next rebuild.
+struct NoLookup {
+    static constexpr bool enabled{false};
+};
+
+template <typename Key = std::identity, typename Hash = void>
+struct HashLookup {
+    static constexpr bool enabled{true};
+};
+
+template <typename Lookup, typename T, typename NodePointer,
+          typename Allocator>
+class ValueLookup {
+public:
+    explicit constexpr ValueLookup(const Allocator&) {}
+
+    [[nodiscard]]
+    constexpr bool valid() const { return false; }
+
+    [[nodiscard]]
+    constexpr std::size_t bytes() const { return 0; }
+
+    constexpr void clear() {}
+    constexpr void invalidate() {}
+    constexpr void rebuild(NodePointer, std::size_t) {}
+
+    constexpr void linking(NodePointer, NodePointer, NodePointer) {}
+    constexpr void linking_chain(NodePointer, NodePointer, NodePointer,
+                                 NodePointer) {}
+    constexpr void unlinking(NodePointer, NodePointer) {}
+    constexpr void moving(NodePointer, NodePointer, NodePointer, NodePointer,
+                          NodePointer) {}
+
+    friend constexpr void swap(ValueLookup&, ValueLookup&) noexcept {}
+};
+
+template <typename Key, typename Hash, typename T, typename NodePointer,
+          typename Allocator>
+class ValueLookup<HashLookup<Key, Hash>, T, NodePointer, Allocator> {
+    using key_type = std::remove_cvref_t<std::invoke_result_t<Key&, const T&>>;
+    using hasher   = std::conditional_t<std::is_void_v<Hash>,
+                                        std::hash<key_type>, Hash>;
+
+    // The table is keyed by already computed hashes.
+    struct hash_value {
+        constexpr std::size_t operator()(std::size_t hash) const noexcept {
+            return hash;
+        }
+    };
+
+    using entry           = std::pair<const std::size_t, NodePointer>;
+    using entry_allocator =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<
+            entry>;
+
+    // Hash of an element -> the node before it, nullptr for the first one.
+    std::unordered_multimap<std::size_t, NodePointer, hash_value,
+                            std::equal_to<>, entry_allocator> entries_;
+
+    [[no_unique_address]] Key    key_{};
+    [[no_unique_address]] hasher hash_{};
+
+    // False after a rebuild failed: the table is empty and ignores
+    // updates until the next rebuild.
+    bool valid_{true};
+
+    [[nodiscard]]
+    std::size_t hash_of(const T& value) const {
+        return hash_(std::invoke(key_, value));
+    }
+
+    // The entry of `node`, which follows `prev`.
+    [[nodiscard]]
+    auto entry_of(NodePointer node, NodePointer prev) {
+        const auto [first, last] = entries_.equal_range(hash_of(node->data));
+        return std::find_if(first, last, [prev](const entry& e) {
+            return e.second == prev;
+        });
+    }
+
+public:
+    explicit ValueLookup(const Allocator& alloc)
+        : entries_(entry_allocator(alloc)) {}
+
+    // Approximate: the bucket array plus an entry and a link per element.
+    [[nodiscard]]
+    std::size_t bytes() const {
+        return entries_.bucket_count() * sizeof(void*) +
+               entries_.size() * (sizeof(entry) + sizeof(void*));
+    }
+
+    [[nodiscard]]
+    bool valid() const { return valid_; }
+
+    void clear() {
+        entries_.clear();
+        valid_ = true;
+    }
+
+    void invalidate() {
+        entries_.clear();
+        valid_ = false;
+    }
+
+    // Leaves the table unchanged if it throws.
+    void rebuild(NodePointer root, std::size_t size) {
+        auto entries = decltype(entries_)(entries_.get_allocator());
+        entries.reserve(size);
+        NodePointer prev{nullptr};
+        for (auto current{root}; current; prev = current,
+                current = current->next) {
+            entries.emplace(hash_of(current->data), prev);
+        }
+        swap(entries_, entries);
+        valid_ = true;
+    }
+
+    // The nodes from `first` to `last`, already chained to each other, are
+    // about to be linked in between `prev` and `next`. Called before any
+    // link changes; leaves the table unchanged if it throws.
+    void linking_chain(NodePointer first, NodePointer last, NodePointer prev,
+                       NodePointer next) {
+        if (!valid_) return;
+
+        // Moved first, so that the new entry after `prev` cannot be
+        // mistaken for the one of `next`.
+        if (next) entry_of(next, prev)->second = last;
+
+        std::size_t added{};
+        try {
+            for (auto current{first}, before{prev}; ;
+                    before = current, current = current->next) {
+                entries_.emplace(hash_of(current->data), before);
+                ++added;
+                if (current == last) break;
+            }
+        } catch (...) {
+            for (auto current{first}, before{prev}; added > 0; --added,
+                    before = current, current = current->next) {
+                entries_.erase(entry_of(current, before));
+            }
+            if (next) entry_of(next, last)->second = prev;
+            throw;
+        }
+    }
+
+    // `node` is about to be linked in between `prev` and `next`.
+    void linking(NodePointer node, NodePointer prev, NodePointer next) {
+        linking_chain(node, node, prev, next);
+    }
+
+    // `node`, which follows `prev`, is about to be unlinked; its links must
+    // still be intact.
+    void unlinking(NodePointer node, NodePointer prev) {
+        if (!valid_) return;
+
+        entries_.erase(entry_of(node, prev));
+        if (node->next) entry_of(node->next, node)->second = prev;
+    }
+
+    // The nodes from `first` to `last`, which follow `before`, are about to
+    // be moved within the list to between `dest` and `next`. Unlike
+    // unlinking and linking them again this only rewrites entries, and so
+    // cannot throw.
+    void moving(NodePointer first, NodePointer last, NodePointer before,
+                NodePointer dest, NodePointer next) {
+        if (!valid_) return;
+
+        const auto first_entry = entry_of(first, before);
+        const auto after_entry = last->next ? entry_of(last->next, last)
+                                            : entries_.end();
+        const auto next_entry  = next ? entry_of(next, dest)
+                                      : entries_.end();
+        first_entry->second = dest;
+        if (after_entry != entries_.end()) after_entry->second = before;
+        if (next_entry != entries_.end()) next_entry->second = last;
+    }
+
+    // The node before some node holding an element equal to `value`
+    // (nullptr for `root`), or nothing if there is none. The table must be
+    // valid, as for count().
+    [[nodiscard]]
+    std::optional<NodePointer> find(const T& value, NodePointer root) const {
+        const auto [first, last] = entries_.equal_range(hash_of(value));
+        for (auto it{first}; it != last; ++it) {
+            const auto node = it->second ? it->second->next : root;
+            if (node->data == value) return it->second;
+        }
+        return std::nullopt;
+    }
+
+    [[nodiscard]]
+    std::size_t count(const T& value, NodePointer root) const {
+        const auto [first, last] = entries_.equal_range(hash_of(value));
+        return static_cast<std::size_t>(
+            std::count_if(first, last, [&](const entry& e) {
+                const auto node = e.second ? e.second->next : root;
+                return node->data == value;
+            }));
+    }
+
+    friend void swap(ValueLookup& l1, ValueLookup& l2) noexcept {
+        using std::swap;
+        swap(l1.entries_, l2.entries_);
+        swap(l1.valid_, l2.valid_);
+    }
+};
@@ -0,0 +1,234 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// Hazard pointers for the lock-free containers.
+//
+// A thread that is about to dereference a shared node publishes its address
+// in one of its hazard slots. Removed nodes are retired instead of deleted,
+// and a retired node is only deleted once no slot of any thread holds it.
+// Because a retired node cannot be freed and reallocated while some thread
+// still protects it, this also rules out the ABA problem on compare-exchange
+// of protected pointers.
+namespace hazard {
+
+inline constexpr std::size_t slots_per_thread{4};
+inline constexpr std::size_t min_scan_batch{64};
+
+namespace detail {
+
+struct Record {
+    std::atomic<const void*> slots[slots_per_thread]{};
+    std::atomic<bool>        active{};
+    Record*                  next{};
+};
+
+struct Retired {
+    void* pointer;
+    void (*deleter)(void*);
+};
+
+class Domain {
+    std::atomic<Record*> records_{};
+
+    std::mutex           orphans_mutex_;
+    std::vector<Retired> orphans_;
+
+public:
+    Domain() = default;
+
+    Domain(const Domain&)            = delete;
+    Domain& operator=(const Domain&) = delete;
+
+    // Runs after every thread is gone, so nothing can be protected anymore.
+    ~Domain() {
+        for (const auto& retired : orphans_) {
+            retired.deleter(retired.pointer);
+        }
+        for (auto record{records_.load()}; record;) {
+            const auto next = record->next;
+            delete record;
+            record = next;
+        }
+    }
+
+    Record* acquire_record() {
+        for (auto record{records_.load(std::memory_order_acquire)}; record;
+                record = record->next) {
+            bool expected{false};
+            if (record->active.compare_exchange_strong(
+                    expected, true, std::memory_order_acq_rel)) {
+                return record;
+            }
+        }
+
+        const auto record = new Record{};
+        record->active.store(true, std::memory_order_relaxed);
+        record->next = records_.load(std::memory_order_relaxed);
+        while (!records_.compare_exchange_weak(
+                record->next, record, std::memory_order_release,
+                std::memory_order_relaxed));
+        return record;
+    }
+
+    void release_record(Record* record) {
+        for (auto& slot : record->slots) {
+            slot.store(nullptr, std::memory_order_release);
+        }
+        record->active.store(false, std::memory_order_release);
+    }
+
+    [[nodiscard]]
+    std::size_t slot_count() const {
+        std::size_t count{};
+        for (auto record{records_.load(std::memory_order_acquire)}; record;
+                record = record->next) {
+            count += slots_per_thread;
+        }
+        return count;
+    }
+
+    // Deletes every entry of `retired` that no thread protects and keeps
+    // the others.
+    void scan(std::vector<Retired>& retired) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        std::vector<const void*> protected_pointers;
+        for (auto record{records_.load(std::memory_order_acquire)}; record;
+                record = record->next) {
+            for (const auto& slot : record->slots) {
+                if (const auto p = slot.load(std::memory_order_acquire)) {
+                    protected_pointers.push_back(p);
+                }
+            }
+        }
+        std::sort(protected_pointers.begin(), protected_pointers.end());
+
+        const auto kept = std::partition(retired.begin(), retired.end(),
+            [&protected_pointers](const Retired& r) {
+                return std::binary_search(protected_pointers.begin(),
+                                          protected_pointers.end(),
+                                          static_cast<const void*>(r.pointer));
+            });
+        for (auto it{kept}; it != retired.end(); ++it) {
+            it->deleter(it->pointer);
+        }
+        retired.erase(kept, retired.end());
+    }
+
+    // Takes over nodes a finishing thread could not free yet.
+    void adopt(std::vector<Retired>& retired) {
+        std::lock_guard lock{orphans_mutex_};
+        orphans_.insert(orphans_.end(), retired.begin(), retired.end());
+        retired.clear();
+        scan(orphans_);
+    }
+};
+
+inline Domain& domain() {
+    static Domain instance;
+    return instance;
+}
+
+// Per-thread state: the hazard slots of this thread and what it retired.
+class ThreadState {
+    Record*              record_;
+    bool                 in_use_[slots_per_thread]{};
+    std::vector<Retired> retired_;
+
+public:
+    ThreadState() : record_{domain().acquire_record()} {}
+
+    ThreadState(const ThreadState&)            = delete;
+    ThreadState& operator=(const ThreadState&) = delete;
+
+    ~ThreadState() {
+        domain().release_record(record_);
+        domain().scan(retired_);
+        if (!retired_.empty()) {
+            domain().adopt(retired_);
+        }
+    }
+
+    std::atomic<const void*>* acquire_slot() {
+        for (std::size_t i{}; i < slots_per_thread; ++i) {
+            if (!in_use_[i]) {
+                in_use_[i] = true;
+                return &record_->slots[i];
+            }
+        }
+        return nullptr;
+    }
+
+    void release_slot(std::atomic<const void*>* slot) {
+        slot->store(nullptr, std::memory_order_release);
+        in_use_[slot - record_->slots] = false;
+    }
+
+    void retire(Retired retired) {
+        retired_.push_back(retired);
+        // Scanning costs O(slots), so only do it once enough nodes piled
+        // up for the scan to free a proportional amount of them.
+        if (retired_.size() >= min_scan_batch &&
+                retired_.size() >= 2 * domain().slot_count()) {
+            domain().scan(retired_);
+        }
+    }
+};
+
+inline ThreadState& thread_state() {
+    // Constructed after domain(), hence destroyed before it.
+    domain();
+    thread_local ThreadState state;
+    return state;
+}
+
+}
+
+// Owns one hazard slot of the calling thread for its lifetime.
+class HazardPointer {
+    std::atomic<const void*>* slot_;
+
+public:
+    HazardPointer() : slot_{detail::thread_state().acquire_slot()} {
+        // More simultaneous hazard pointers per thread than slots_per_thread
+        // is a programming error of the container using them.
+        if (!slot_) std::terminate();
+    }
+
+    HazardPointer(const HazardPointer&)            = delete;
+    HazardPointer& operator=(const HazardPointer&) = delete;
+
+    ~HazardPointer() { detail::thread_state().release_slot(slot_); }
+
+    // Loads `source` and publishes the loaded pointer until it is stable,
+    // so the returned node cannot be deleted while this hazard holds it.
+    template <typename T>
+    T* protect(const std::atomic<T*>& source) {
+        auto pointer = source.load(std::memory_order_relaxed);
+        for (;;) {
+            slot_->store(pointer, std::memory_order_seq_cst);
+            const auto reloaded = source.load(std::memory_order_acquire);
+            if (reloaded == pointer) return pointer;
+            pointer = reloaded;
+        }
+    }
+
+    // Stops protecting anything, but keeps the slot.
+    void reset() { slot_->store(nullptr, std::memory_order_release); }
+};
+
+// Hands `pointer` over for deletion once no hazard pointer protects it.
+template <typename T>
+void retire(T* pointer) {
+    detail::thread_state().retire(detail::Retired{
+        pointer, [](void* p) { delete static_cast<T*>(p); }});
+}
+
+}
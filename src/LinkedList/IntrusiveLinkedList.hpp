@@ -0,0 +1,383 @@
+#pragma once
+
+#include "LinkedList/LinkedList.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <format>
+#include <ostream>
+#include <expected>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+// Links embedded in the objects of an IntrusiveLinkedList. Besides the link
+// to the next object a hook keeps the one to the previous object, which is
+// what makes unlinking an object O(1) without walking the list.
+//
+// Copying an object does not copy its membership: the copy starts out
+// unlinked and assigning leaves the hook alone.
+class LinkedListHook {
+    LinkedListHook* next_{};
+    LinkedListHook* prev_{};
+
+    template <typename, typename>
+    friend class IntrusiveLinkedList;
+
+    template <typename, typename>
+    friend class IntrusiveLinkedListIterator;
+
+public:
+    constexpr LinkedListHook() = default;
+
+    constexpr LinkedListHook(const LinkedListHook&) noexcept {}
+
+    constexpr LinkedListHook& operator=(const LinkedListHook&) noexcept {
+        return *this;
+    }
+
+    [[nodiscard]]
+    constexpr bool is_linked() const { return prev_ != nullptr; }
+};
+
+// T derives from LinkedListHook.
+struct BaseHook {};
+
+// T has a LinkedListHook member, e.g. MemberHook<&Task::ready_hook>. Several
+// member hooks let an object be in several lists at once.
+template <auto Member>
+struct MemberHook {};
+
+namespace detail {
+
+template <typename T, typename Hook>
+struct HookTraits;
+
+template <typename T>
+struct HookTraits<T, BaseHook> {
+    static_assert(std::is_base_of_v<LinkedListHook, T>,
+        "BaseHook requires T to derive from LinkedListHook");
+
+    static constexpr LinkedListHook& to_hook(T& object) { return object; }
+
+    static constexpr T& from_hook(LinkedListHook& hook) {
+        return static_cast<T&>(hook);
+    }
+};
+
+template <typename T, LinkedListHook T::*Member>
+struct HookTraits<T, MemberHook<Member>> {
+    static constexpr LinkedListHook& to_hook(T& object) {
+        return object.*Member;
+    }
+
+    // Not constexpr, unlike for BaseHook: getting from a member back to
+    // its object takes a reinterpret_cast.
+    static T& from_hook(LinkedListHook& hook) {
+        return *reinterpret_cast<T*>(
+            reinterpret_cast<std::byte*>(&hook) - offset());
+    }
+
+private:
+    // Offset of the hook inside T. Like Boost.Intrusive it is read out of
+    // the pointer to member, which holds exactly that offset on the
+    // Itanium C++ ABI and, as an int, on MSVC for classes without virtual
+    // bases.
+    static std::ptrdiff_t offset() {
+#if defined(_MSC_VER)
+        static_assert(sizeof(Member) == sizeof(std::int32_t),
+            "MemberHook requires T without virtual bases");
+        return std::bit_cast<std::int32_t>(Member);
+#else
+        static_assert(sizeof(Member) == sizeof(std::ptrdiff_t),
+            "MemberHook requires a pointer to member holding an offset");
+        return std::bit_cast<std::ptrdiff_t>(Member);
+#endif
+    }
+};
+
+}
+
+template <typename T, typename Hook>
+class IntrusiveLinkedListIterator {
+    using object       = std::remove_const_t<T>;
+    using hook_traits  = detail::HookTraits<object, Hook>;
+    using hook_pointer = LinkedListHook*;
+
+    hook_pointer current_;
+
+    template <typename, typename>
+    friend class IntrusiveLinkedList;
+
+    template <typename, typename>
+    friend class IntrusiveLinkedListIterator;
+
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type        = object;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = T*;
+    using reference         = T&;
+
+    constexpr IntrusiveLinkedListIterator() : current_{nullptr} {}
+
+    explicit constexpr IntrusiveLinkedListIterator(hook_pointer current)
+        : current_(current) {}
+
+    // iterator -> const_iterator
+    template <typename U>
+        requires (std::is_const_v<T> && std::is_same_v<const U, T>)
+    constexpr IntrusiveLinkedListIterator(
+            const IntrusiveLinkedListIterator<U, Hook>& other)
+        : current_(other.current_) {}
+
+    constexpr T& operator*() const {
+        return hook_traits::from_hook(*current_);
+    }
+
+    constexpr T* operator->() const { return &**this; }
+
+    constexpr IntrusiveLinkedListIterator& operator++() {
+        current_ = current_->next_;
+        return *this;
+    }
+
+    constexpr IntrusiveLinkedListIterator operator++(int) {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    constexpr IntrusiveLinkedListIterator& operator--() {
+        current_ = current_->prev_;
+        return *this;
+    }
+
+    constexpr IntrusiveLinkedListIterator operator--(int) {
+        auto tmp = *this;
+        --*this;
+        return tmp;
+    }
+
+    friend constexpr bool operator==(const IntrusiveLinkedListIterator& lhs,
+                                     const IntrusiveLinkedListIterator& rhs) {
+        return lhs.current_ == rhs.current_;
+    }
+};
+
+// List of objects that carry their own links (see LinkedListHook). The list
+// never allocates and never copies an object: it only links and unlinks
+// objects owned elsewhere, which must stay alive and in place while they
+// are linked. Destroying the list unlinks its objects.
+//
+// Internally the hooks form a ring through a sentinel hook owned by the
+// list, so there is no special case for the first or the last object.
+template <typename T, typename Hook = BaseHook>
+class IntrusiveLinkedList {
+    using hook_traits = detail::HookTraits<T, Hook>;
+
+    LinkedListHook head_;
+    std::size_t    size_{};
+
+    [[nodiscard]]
+    static constexpr LinkedListHook& hook_of(T& object) {
+        return hook_traits::to_hook(object);
+    }
+
+    [[nodiscard]]
+    LinkedListHook* sentinel() const {
+        return const_cast<LinkedListHook*>(&head_);
+    }
+
+    void link_before(LinkedListHook& position, LinkedListHook& hook) {
+        hook.next_ = &position;
+        hook.prev_ = position.prev_;
+        position.prev_->next_ = &hook;
+        position.prev_        = &hook;
+        ++size_;
+    }
+
+    void unlink_hook(LinkedListHook& hook) {
+        hook.prev_->next_ = hook.next_;
+        hook.next_->prev_ = hook.prev_;
+        hook.next_ = hook.prev_ = nullptr;
+        --size_;
+    }
+
+    // Makes `other`'s objects this list's; this list must be empty.
+    void take_from(IntrusiveLinkedList& other) {
+        if (other.is_empty()) return;
+
+        head_.next_ = other.head_.next_;
+        head_.prev_ = other.head_.prev_;
+        head_.next_->prev_ = &head_;
+        head_.prev_->next_ = &head_;
+        size_ = std::exchange(other.size_, 0);
+        other.head_.next_ = other.head_.prev_ = &other.head_;
+    }
+
+    friend struct std::formatter<IntrusiveLinkedList>;
+
+public:
+    using value_type      = T;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+
+    using iterator        = IntrusiveLinkedListIterator<T, Hook>;
+    using const_iterator  = IntrusiveLinkedListIterator<const T, Hook>;
+
+    IntrusiveLinkedList() { head_.next_ = head_.prev_ = &head_; }
+
+    IntrusiveLinkedList(const IntrusiveLinkedList&)            = delete;
+    IntrusiveLinkedList& operator=(const IntrusiveLinkedList&) = delete;
+
+    IntrusiveLinkedList(IntrusiveLinkedList&& other) noexcept
+            : IntrusiveLinkedList() {
+        take_from(other);
+    }
+
+    IntrusiveLinkedList& operator=(IntrusiveLinkedList&& other) noexcept {
+        if (this == &other) return *this;
+        clear();
+        take_from(other);
+        return *this;
+    }
+
+    ~IntrusiveLinkedList() { clear(); }
+
+    // Unlinks every object; the objects themselves are left alone.
+    void clear() {
+        for (auto current{head_.next_}; current != &head_;) {
+            const auto next = current->next_;
+            current->next_ = current->prev_ = nullptr;
+            current = next;
+        }
+        head_.next_ = head_.prev_ = &head_;
+        size_ = 0;
+    }
+
+    [[nodiscard]]
+    std::size_t size() const { return size_; };
+
+    [[nodiscard]]
+    auto begin() { return iterator{head_.next_}; }
+
+    [[nodiscard]]
+    auto end() { return iterator{sentinel()}; }
+
+    [[nodiscard]]
+    auto begin() const { return const_iterator{head_.next_}; }
+
+    [[nodiscard]]
+    auto end() const { return const_iterator{sentinel()}; }
+
+    [[nodiscard]]
+    auto cbegin() const { return begin(); }
+
+    [[nodiscard]]
+    auto cend() const { return end(); }
+
+    [[nodiscard]]
+    auto is_empty() const { return size_ == 0; }
+
+    [[nodiscard]]
+    auto contains(const_reference value) const {
+        return std::find(begin(), end(), value) != end();
+    }
+
+    [[nodiscard]]
+    std::expected<std::reference_wrapper<value_type>, LinkedListError>
+    front() {
+        if (is_empty()) return std::unexpected(LinkedListError::EmptyList);
+        return *begin();
+    }
+
+    [[nodiscard]]
+    std::expected<std::reference_wrapper<const value_type>, LinkedListError>
+    front() const {
+        if (is_empty()) return std::unexpected(LinkedListError::EmptyList);
+        return *begin();
+    }
+
+    [[nodiscard]]
+    std::expected<std::reference_wrapper<value_type>, LinkedListError>
+    back() {
+        if (is_empty()) return std::unexpected(LinkedListError::EmptyList);
+        return *--end();
+    }
+
+    [[nodiscard]]
+    std::expected<std::reference_wrapper<const value_type>, LinkedListError>
+    back() const {
+        if (is_empty()) return std::unexpected(LinkedListError::EmptyList);
+        return *--end();
+    }
+
+    // `object` must not be linked into a list through this hook already.
+    void push_front(T& object) { link_before(*head_.next_, hook_of(object)); }
+
+    void push_back(T& object) { link_before(head_, hook_of(object)); }
+
+    // Links `object` right before `pos`, which may be end().
+    iterator insert(const_iterator pos, T& object) {
+        auto& hook = hook_of(object);
+        link_before(*pos.current_, hook);
+        return iterator{&hook};
+    }
+
+    void pop_front() {
+        if (!is_empty()) unlink_hook(*head_.next_);
+    }
+
+    void pop_back() {
+        if (!is_empty()) unlink_hook(*head_.prev_);
+    }
+
+    // Unlinks `object`, which must be linked into this list, in O(1).
+    void unlink(T& object) { unlink_hook(hook_of(object)); }
+
+    // Unlinks the object at `pos` and returns the position after it.
+    iterator erase(const_iterator pos) {
+        const auto next = pos.current_->next_;
+        unlink_hook(*pos.current_);
+        return iterator{next};
+    }
+
+    friend bool operator==(
+            const IntrusiveLinkedList& lhs, const IntrusiveLinkedList& rhs) {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    friend std::ostream& operator<<(
+            std::ostream& os, const IntrusiveLinkedList& ll) {
+        os << "[";
+        std::for_each(std::begin(ll), std::end(ll), [&os](const auto& element) {
+            os << element << " -> "; });
+        os << "NULL]";
+        return os;
+    };
+
+    // Unlinks the first object equal to `value`.
+    void remove(const_reference value) {
+        const auto it = std::find(cbegin(), cend(), value);
+        if (it != cend()) erase(it);
+    }
+
+    // Unlinks every object equal to `value`.
+    void remove_all(const_reference value) {
+        for (auto it{cbegin()}; it != cend();) {
+            if (*it == value) {
+                it = erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+};
+
+template <typename T, typename Hook>
+struct std::formatter<IntrusiveLinkedList<T, Hook>>
+    : LinkedListFormatter<T> {};
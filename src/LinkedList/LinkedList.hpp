@@ -1,14 +1,27 @@
 #pragma once
 
+#include "LinkedList/HashLookup.hpp"
+#include "LinkedList/NodePool.hpp"
+#include "LinkedList/PositionIndex.hpp"
+#include "LinkedList/Prefetch.hpp"
+#include "LinkedList/Stats.hpp"
+
 #include <algorithm>
 #include <utility>
 #include <format>
 #include <ostream>
 #include <expected>
 #include <functional>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <ranges>
+#include <string_view>
 
 enum class LinkedListError {
     EmptyList,
+    CapacityExceeded,
+    OutOfRange,
 };
 
 template <typename T>
@@ -16,11 +29,21 @@ struct Node {
     T     data{};
     Node* next{};
 
-    explicit Node(T data, Node* next = nullptr)
+    explicit constexpr Node(T data, Node* next = nullptr)
         : data{std::move(data)}, next{next}
     {}
+
+    // Constructs the element directly in the node from `args`.
+    template <typename... Args>
+    explicit constexpr Node(std::in_place_t, Node* next, Args&&... args)
+        : data(std::forward<Args>(args)...), next{next}
+    {}
 };
 
+template <typename T, typename Allocator, typename Traversal, typename Stats,
+          typename Index, typename Lookup>
+class LinkedList;
+
 template <typename T>
 class LinkedListIterator {
     using node           = std::conditional_t<
@@ -28,20 +51,33 @@ class LinkedListIterator {
                                         const Node<std::remove_const_t<T>>,
                                         Node<T>>;
     using node_pointer   = node*;
-    using node_reference = node&;
 
     node_pointer current_;
 
+    template <typename, typename, typename, typename, typename, typename>
+    friend class LinkedList;
+
+    template <typename>
+    friend class LinkedListIterator;
+
 public:
     using iterator_category = std::forward_iterator_tag;
-    using value_type        = node;
+    using value_type        = std::remove_const_t<T>;
     using difference_type   = std::ptrdiff_t;
-    using pointer           = node_pointer;
-    using reference         = node_reference;
+    using pointer           = T*;
+    using reference         = T&;
+
+    constexpr LinkedListIterator() : current_{nullptr} {}
 
     explicit constexpr LinkedListIterator(node_pointer current)
         : current_(current) {}
 
+    // iterator -> const_iterator
+    template <typename U>
+        requires (std::is_const_v<T> && std::is_same_v<const U, T>)
+    constexpr LinkedListIterator(const LinkedListIterator<U>& other)
+        : current_(other.current_) {}
+
     constexpr T& operator*()  const { return  current_->data; };
     constexpr T* operator->() const { return &current_->data; };
 
@@ -50,6 +86,12 @@ public:
         return *this;
     }
 
+    constexpr LinkedListIterator operator++(int) {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
     friend constexpr auto operator==(
             const LinkedListIterator& lhs, const LinkedListIterator& rhs) {
         return lhs.current_ == rhs.current_;
@@ -61,30 +103,352 @@ public:
     }
 };
 
-template <typename T>
+// Traversal selects how the list walks its nodes in contains(), remove_all(),
+// copying and clear(): SequentialTraversal, or PrefetchTraversal<Distance>
+// to prefetch nodes ahead of the walk (see Prefetch.hpp).
+//
+// Stats receives node allocations, the nodes visited by walking operations
+// and the peak size: NoStats compiles away, CountingStats counts them (see
+// Stats.hpp). Counters belong to the list object; nodes moved between lists
+// by splicing or merging are freed by a list that did not allocate them.
+//
+// Index selects how at(), insert_at() and the other positional operations
+// find a position: NoIndex walks from the first node, BlockIndex keeps an
+// index of every ~sqrt(n)-th node (see PositionIndex.hpp).
+//
+// Lookup selects how contains(), count(), remove() and remove_all() find
+// elements: NoLookup walks the list, HashLookup<Key, Hash> keeps a hash
+// table from elements to the nodes before them (see HashLookup.hpp).
+template <typename T, typename Allocator = std::allocator<T>,
+          typename Traversal = SequentialTraversal,
+          typename Stats = NoStats,
+          typename Index = NoIndex,
+          typename Lookup = NoLookup>
 class LinkedList {
-    using node = Node<T>;
+    using node         = Node<T>;
     using node_pointer = node*;
 
+    using allocator_traits = std::allocator_traits<Allocator>;
+    using node_allocator   =
+        typename allocator_traits::template rebind_alloc<node>;
+    using node_traits      = std::allocator_traits<node_allocator>;
+
+    using lookahead        = NodeLookahead<Traversal, node_pointer>;
+    using position_index   =
+        PositionIndex<Index, node_pointer, node_allocator>;
+    using value_lookup     =
+        ValueLookup<Lookup, T, node_pointer, node_allocator>;
+
+    static_assert(std::is_same_v<typename node_traits::pointer, node_pointer>,
+        "LinkedList supports only allocators with raw pointers");
+
     node_pointer root_{};
+    node_pointer tail_{};
     std::size_t  size_{};
 
+    [[no_unique_address]] node_allocator alloc_{};
+
+    NodePool<node, node_allocator> pool_{};
+
+    [[no_unique_address]] position_index index_{alloc_};
+
+    [[no_unique_address]] value_lookup lookup_{alloc_};
+
+    // Mutable so that const walks can report what they visited.
+    [[no_unique_address]] mutable Stats stats_{};
+
+    constexpr void note_size() { stats_.size_changed(size_); }
+
+    constexpr void reindex_positions() {
+        if constexpr (Index::enabled) index_.rebuild(root_, size_);
+    }
+
+    // Rebuilds the indexes after an O(n) operation relinked the nodes. The
+    // lookup table is dropped first, so that it is never left stale when a
+    // rebuild throws.
+    constexpr void reindex() {
+        lookup_.invalidate();
+        reindex_positions();
+        if constexpr (Lookup::enabled) lookup_.rebuild(root_, size_);
+    }
+
+    // Builds the lookup table again if a rebuild failed before.
+    constexpr void restore_lookup() {
+        if (!lookup_.valid()) lookup_.rebuild(root_, size_);
+    }
+
+    // Node at `position` < size_, found through the index when it is up
+    // to date, and the number of links followed to reach it.
+    [[nodiscard]]
+    constexpr std::pair<node_pointer, std::size_t>
+    walk_to(std::size_t position) const {
+        if (position + 1 == size_) return {tail_, 0};
+
+        auto [current, steps] = index_.valid()
+            ? index_.seek(position)
+            : std::pair{root_, position};
+        for (auto i{steps}; i > 0; --i) current = current->next;
+        return {current, steps};
+    }
+
+    [[nodiscard]]
+    constexpr node_pointer node_at(std::size_t position) {
+        if (!index_.valid()) reindex_positions();
+        return walk_to(position).first;
+    }
+
+    template <typename... Args>
+    constexpr node_pointer create_node(Args&&... args) {
+        const auto new_node = pool_.allocate(alloc_);
+        try {
+            node_traits::construct(
+                alloc_, new_node, std::forward<Args>(args)...);
+        } catch (...) {
+            pool_.deallocate(alloc_, new_node);
+            throw;
+        }
+        stats_.node_allocated();
+        return new_node;
+    }
+
+    constexpr void destroy_node(node_pointer n) {
+        node_traits::destroy(alloc_, n);
+        pool_.deallocate(alloc_, n);
+        stats_.node_freed();
+    }
+
+    // Destroys the nodes from `first` to `last`, which are chained to each
+    // other but not linked into the list.
+    constexpr void destroy_chain(node_pointer first, node_pointer last) {
+        for (auto current{first}; ;) {
+            const auto next = current->next;
+            destroy_node(current);
+            if (current == last) break;
+            current = next;
+        }
+    }
+
+    // Enters the new nodes from `first` to `last`, about to be linked in
+    // between `prev` and `next`, into the lookup table. If the table throws
+    // the nodes are destroyed, which leaves the list as it was.
+    constexpr void look_up_new(node_pointer first, node_pointer last,
+                               node_pointer prev, node_pointer next) {
+        if constexpr (Lookup::enabled) {
+            try {
+                lookup_.linking_chain(first, last, prev, next);
+            } catch (...) {
+                destroy_chain(first, last);
+                throw;
+            }
+        }
+    }
+
     constexpr void copy_from(const LinkedList& other) {
         node_pointer* current = &root_;
+        lookahead ahead{other.root_};
         for (node_pointer other_current{other.root_}; other_current;
                 other_current = other_current->next,
-                current = &((*current)->next)) {
-            *current = new Node{other_current->data};
+                current = &((*current)->next), ahead.advance()) {
+            *current = create_node(other_current->data);
+            tail_ = *current;
+            ++size_;
+        }
+        stats_.visited(LinkedListOp::Copy, other.size_);
+        note_size();
+        reindex();
+    }
+
+    // Replaces the elements with copies of those of `other`. If copying an
+    // element or building the lookup table throws, the list is left as it
+    // was.
+    constexpr void assign_copy(const LinkedList& other) {
+        chain copies{};
+        value_lookup lookup{alloc_};
+        try {
+            lookahead ahead{other.root_};
+            node_pointer* link{&copies.first};
+            for (node_pointer other_current{other.root_}; other_current;
+                    other_current = other_current->next, ahead.advance()) {
+                *link = create_node(other_current->data);
+                copies.last = *link;
+                link = &copies.last->next;
+                ++copies.count;
+            }
+            if constexpr (Lookup::enabled) {
+                lookup.rebuild(copies.first, copies.count);
+            }
+        } catch (...) {
+            if (copies.first) destroy_chain(copies.first, copies.last);
+            throw;
+        }
+
+        clear();
+        root_ = copies.first;
+        tail_ = copies.last;
+        size_ = copies.count;
+        swap(lookup_, lookup);
+        stats_.visited(LinkedListOp::Copy, other.size_);
+        note_size();
+        reindex_positions();
+    }
+
+    struct chain {
+        node_pointer first{};
+        node_pointer last{};
+        std::size_t  count{};
+    };
+
+    // Builds an unlinked chain of nodes holding the elements of `range`.
+    // Nodes are allocated one by one, in list order, so that they can
+    // still be relinked into other lists. Only once the list recycles
+    // nodes (see reserve()) and their number is known up front are they
+    // reserved in one block of the pool.
+    template <typename R>
+    constexpr chain make_chain(R&& range) {
+        if constexpr (std::ranges::sized_range<R> ||
+                      std::ranges::forward_range<R>) {
+            if (pool_.recycling()) {
+                const auto count =
+                    static_cast<std::size_t>(std::ranges::distance(range));
+                if (count > 1) pool_.reserve(alloc_, count);
+            }
+        }
+
+        chain result{};
+        try {
+            for (node_pointer* link{&result.first}; auto&& element : range) {
+                *link = create_node(std::in_place, nullptr,
+                                    std::forward<decltype(element)>(element));
+                result.last = *link;
+                link = &result.last->next;
+                ++result.count;
+            }
+        } catch (...) {
+            if (result.first) destroy_chain(result.first, result.last);
+            throw;
         }
-        size_ = other.size_;
+        return result;
     }
 
+    // Replaces the index and the lookup table, which must be empty, with
+    // ones using the list's allocator, after the allocator was replaced.
+    constexpr void reset_bookkeeping() {
+        std::destroy_at(&index_);
+        std::construct_at(&index_, alloc_);
+        std::destroy_at(&lookup_);
+        std::construct_at(&lookup_, alloc_);
+    }
+
+    // Takes over the nodes of `other` together with the pool they may have
+    // come from; `other` is left with this list's (spare) pool.
+    constexpr void steal_from(LinkedList& other) noexcept {
+        root_ = std::exchange(other.root_, nullptr);
+        tail_ = std::exchange(other.tail_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        swap(pool_, other.pool_);
+        swap(index_, other.index_);
+        other.index_.clear();
+        swap(lookup_, other.lookup_);
+        other.lookup_.clear();
+        note_size();
+    }
+
+    // Nodes can be relinked from `other` into this list only when this
+    // list's allocator can free them and they are not part of the chunks
+    // of other's pool. Nodes of a block (see relinearize()) can only be
+    // taken over all together.
+    [[nodiscard]]
+    constexpr bool can_adopt_nodes_of(const LinkedList& other) const {
+        return alloc_ == other.alloc_ &&
+               other.pool_.can_transfer_all_nodes();
+    }
+
+    [[nodiscard]]
+    constexpr bool can_adopt_some_nodes_of(const LinkedList& other) const {
+        return alloc_ == other.alloc_ && other.pool_.can_transfer_nodes();
+    }
+
+    // Returns a list holding the elements of `other` whose nodes this list
+    // can adopt; moves the elements one by one only when it has to.
+    constexpr LinkedList adoptable(LinkedList&& other) const {
+        if (can_adopt_nodes_of(other)) return std::move(other);
+
+        LinkedList result(get_allocator());
+        for (auto& element : other) {
+            result.push_back(std::move(element));
+        }
+        other.clear();
+        return result;
+    }
+
+    [[nodiscard]]
+    static constexpr node_pointer node_of(LinkedListIterator<const T> it) {
+        return const_cast<node_pointer>(it.current_);
+    }
+
+    // Destroys the nodes strictly between `before` and `last`.
+    constexpr void erase_between(node_pointer before, node_pointer last) {
+        for (auto current{before->next}; current != last;) {
+            const auto next = current->next;
+            lookup_.unlinking(current, before);
+            destroy_node(current);
+            --size_;
+            current = next;
+        }
+        before->next = last;
+        if (!last) tail_ = before;
+        index_.invalidate();
+    }
+
+    template <typename Compare>
+    static constexpr node_pointer merge_chains(
+            node_pointer first, node_pointer second, Compare& comp) {
+        node_pointer  head{nullptr};
+        node_pointer* link{&head};
+        // Ties take from `first`, which keeps merging stable.
+        while (first && second) {
+            if (comp(second->data, first->data)) {
+                *link  = second;
+                second = second->next;
+            } else {
+                *link = first;
+                first = first->next;
+            }
+            link = &(*link)->next;
+        }
+        *link = first ? first : second;
+        return head;
+    }
+
+    constexpr void update_tail() {
+        tail_ = root_;
+        if (!tail_) return;
+        for (; tail_->next; tail_ = tail_->next);
+    }
+
+    // tail_ is kept up to date by every mutating operation, so the last
+    // node is available without walking the list.
     std::expected<node_pointer, LinkedListError> get_last() const {
-        if (!root_) return std::unexpected(LinkedListError::EmptyList);
+        stats_.visited(LinkedListOp::GetLast, tail_ ? 1 : 0);
+        if (!tail_) return std::unexpected(LinkedListError::EmptyList);
+        return tail_;
+    }
 
-        auto current = root_;
-        for(; current->next; current = current->next);
-        return current;
+    // Unlinks and destroys the node after `prev`, or the first node when
+    // `prev` is nullptr. The position of the node is not known, so the
+    // positional index goes stale.
+    constexpr void erase_after(node_pointer prev) {
+        if (!prev) {
+            pop_front();
+            return;
+        }
+        const auto victim = prev->next;
+        lookup_.unlinking(victim, prev);
+        prev->next = victim->next;
+        if (victim == tail_) tail_ = prev;
+        destroy_node(victim);
+        --size_;
+        index_.invalidate();
     }
 
     friend struct std::formatter<LinkedList>;
@@ -94,65 +458,297 @@ public:
     using reference       = value_type&;
     using const_reference = const value_type&;
 
+    using allocator_type  = Allocator;
+
     using iterator        = LinkedListIterator<T>;
     using const_iterator  = LinkedListIterator<const T>;
 
-    constexpr LinkedList() : root_{nullptr}, size_{0} {}
+    constexpr LinkedList() : root_{nullptr}, tail_{nullptr}, size_{0} {}
 
-    explicit LinkedList(T data) : root_{new node{std::move(data)}}, size_{1} {}
+    explicit constexpr LinkedList(const Allocator& alloc)
+        : root_{nullptr}, tail_{nullptr}, size_{0}, alloc_{alloc} {}
 
-    explicit constexpr LinkedList(std::initializer_list<T> elements)
-            : root_{nullptr}, size_{0} {
+    explicit LinkedList(T data, const Allocator& alloc = Allocator())
+            : root_{nullptr}, tail_{nullptr}, size_{0}, alloc_{alloc} {
+        root_ = tail_ = create_node(std::move(data));
+        size_ = 1;
+        note_size();
+        reindex();
+    }
+
+    explicit constexpr LinkedList(std::initializer_list<T> elements,
+                                  const Allocator& alloc = Allocator())
+            : root_{nullptr}, tail_{nullptr}, size_{0}, alloc_{alloc} {
         node_pointer* current = &root_;
-        for (auto it{elements.begin()}; it != elements.end();
-                ++it, current = &((*current)->next)) {
-            *current = new node(*it);
-            ++size_;
+        try {
+            for (auto it{elements.begin()}; it != elements.end();
+                    ++it, current = &((*current)->next)) {
+                *current = create_node(*it);
+                tail_ = *current;
+                ++size_;
+            }
+            note_size();
+            reindex();
+        } catch (...) {
+            clear();
+            throw;
         }
     }
 
-    constexpr LinkedList(const LinkedList& other) : root_{nullptr}, size_{0} {
-        copy_from(other);
+    template <std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+    constexpr LinkedList(InputIt first, Sentinel last,
+                         const Allocator& alloc = Allocator())
+        : LinkedList(std::from_range,
+                     std::ranges::subrange(std::move(first), last), alloc) {}
+
+    template <std::ranges::input_range R>
+    constexpr LinkedList(std::from_range_t, R&& range,
+                         const Allocator& alloc = Allocator())
+            : root_{nullptr}, tail_{nullptr}, size_{0}, alloc_{alloc} {
+        try {
+            append_range(std::forward<R>(range));
+            reindex_positions();
+        } catch (...) {
+            pool_.release(alloc_);
+            throw;
+        }
+    }
+
+    constexpr LinkedList(const LinkedList& other)
+        : LinkedList(other, node_traits::select_on_container_copy_construction(
+                                other.alloc_)) {}
+
+    constexpr LinkedList(const LinkedList& other, const Allocator& alloc)
+            : root_{nullptr}, tail_{nullptr}, size_{0}, alloc_{alloc} {
+        try {
+            copy_from(other);
+        } catch (...) {
+            clear();
+            throw;
+        }
     }
 
     constexpr LinkedList& operator=(const LinkedList& other) {
         if (this == &other) return *this;
 
-        clear();
-        copy_from(other);
+        if constexpr (
+                node_traits::propagate_on_container_copy_assignment::value) {
+            // Copied with the new allocator first, so that a throwing copy
+            // leaves this list as it was; the index and the lookup table
+            // come along with it and so use the new allocator as well.
+            LinkedList copy(other, other.alloc_);
+            clear();
+            pool_.release(alloc_);
+            alloc_ = other.alloc_;
+            steal_from(copy);
+            stats_.visited(LinkedListOp::Copy, other.size_);
+            return *this;
+        } else {
+            assign_copy(other);
+        }
         return *this;
     }
 
-    constexpr LinkedList(LinkedList&& other) noexcept { swap(*this, other); }
+    constexpr LinkedList(LinkedList&& other) noexcept
+            : alloc_{std::move(other.alloc_)} {
+        steal_from(other);
+    }
+
+    constexpr LinkedList(LinkedList&& other, const Allocator& alloc)
+            : root_{nullptr}, tail_{nullptr}, size_{0}, alloc_{alloc} {
+        if (alloc_ == other.alloc_) {
+            steal_from(other);
+            return;
+        }
+        // Nodes owned by a foreign allocator cannot be adopted; move the
+        // elements one by one instead.
+        for (auto& element : other) {
+            push_back(std::move(element));
+        }
+        other.clear();
+    }
+
+    constexpr LinkedList& operator=(LinkedList&& other) noexcept(
+            node_traits::propagate_on_container_move_assignment::value ||
+            node_traits::is_always_equal::value) {
+        if (this == &other) return *this;
 
-    constexpr LinkedList& operator=(LinkedList&& other) noexcept {
-        // copy & swap idiom
-        LinkedList tmp(std::move(other));
-        swap(*this, tmp);
+        clear();
+        if constexpr (
+                node_traits::propagate_on_container_move_assignment::value) {
+            pool_.release(alloc_);
+            alloc_ = std::move(other.alloc_);
+            steal_from(other);
+            // `other` got this list's index and lookup table, which still
+            // use the allocator this list had before.
+            other.reset_bookkeeping();
+        } else {
+            if (alloc_ == other.alloc_) {
+                steal_from(other);
+                return *this;
+            }
+            for (auto& element : other) {
+                push_back(std::move(element));
+            }
+            other.clear();
+        }
         return *this;
     }
 
-    constexpr ~LinkedList() { clear(); }
+    constexpr ~LinkedList() {
+        clear();
+        pool_.release(alloc_);
+    }
+
+    [[nodiscard]]
+    constexpr allocator_type get_allocator() const {
+        return allocator_type(alloc_);
+    }
 
     constexpr void clear() {
-        for (node_pointer current{root_}; current;) {
+        lookahead ahead{root_};
+        for (node_pointer current{root_}; current; ahead.advance()) {
             const auto next = current->next;
-            delete current;
+            destroy_node(current);
             current = next;
         }
         root_ = nullptr;
+        tail_ = nullptr;
         size_ = 0;
+        index_.clear();
+        lookup_.clear();
     }
 
+    // As for the standard containers, swapping lists whose allocators
+    // neither propagate nor compare equal is undefined behaviour.
     friend constexpr void swap(LinkedList& l1, LinkedList& l2) noexcept {
         using std::swap;
+        if constexpr (node_traits::propagate_on_container_swap::value) {
+            swap(l1.alloc_, l2.alloc_);
+        }
         swap(l1.root_, l2.root_);
+        swap(l1.tail_, l2.tail_);
         swap(l1.size_, l2.size_);
+        swap(l1.pool_, l2.pool_);
+        swap(l1.index_, l2.index_);
+        swap(l1.lookup_, l2.lookup_);
+    }
+
+    // Switches the list to node recycling: storage for at least `count`
+    // elements is allocated up front in one chunk, and nodes released by
+    // pop/remove/clear are kept for reuse instead of being freed. Further
+    // chunks are allocated as needed.
+    void reserve(std::size_t count) {
+        if (count > size_) {
+            pool_.reserve(alloc_, count - size_);
+        } else {
+            pool_.reserve(alloc_, 0);
+        }
+    }
+
+    // Returns spare nodes to the allocator where possible.
+    void shrink_to_fit() { pool_.shrink_to_fit(alloc_); }
+
+    // Moves every element into a freshly allocated block of nodes laid out
+    // in list order and gives the old, scattered nodes back to the
+    // allocator, as does shrink_to_fit() with spare ones. Works for
+    // move-only T. Elements whose move constructor may throw are copied
+    // instead, so that if an element or the lookup table throws, the list
+    // is left as it was; only a move-only T with a throwing move
+    // constructor may be left with elements in a moved-from state.
+    //
+    // The block does not switch the list to recycling: it goes back to the
+    // allocator with the last of its nodes. Until then the whole list can
+    // still be relinked by splice_after(), append() and merge(), but
+    // split_after() and splicing a part of it move the elements.
+    void relinearize() {
+        if (!root_) {
+            shrink_to_fit();
+            return;
+        }
+
+        const auto nodes = pool_.allocate_block(alloc_, size_);
+        std::size_t built{};
+        value_lookup lookup{alloc_};
+        try {
+            for (auto current{root_}; current;
+                    current = current->next, ++built) {
+                node_traits::construct(
+                    alloc_, nodes + built, std::in_place, nullptr,
+                    std::move_if_noexcept(current->data));
+                stats_.node_allocated();
+                if (built > 0) nodes[built - 1].next = nodes + built;
+            }
+            if constexpr (Lookup::enabled) lookup.rebuild(nodes, size_);
+        } catch (...) {
+            auto current = root_;
+            for (std::size_t i{}; i < size_; ++i) {
+                if (i >= built) {
+                    pool_.deallocate(alloc_, nodes + i);
+                    continue;
+                }
+                if constexpr (std::is_nothrow_move_constructible_v<T>) {
+                    // Moved out above; move it back.
+                    std::destroy_at(&current->data);
+                    std::construct_at(&current->data,
+                                      std::move(nodes[i].data));
+                }
+                destroy_node(nodes + i);
+                current = current->next;
+            }
+            throw;
+        }
+
+        for (auto current{root_}; current;) {
+            const auto next = current->next;
+            destroy_node(current);
+            current = next;
+        }
+        root_ = nodes;
+        tail_ = nodes + (size_ - 1);
+        swap(lookup_, lookup);
+        index_.invalidate();
+        shrink_to_fit();
+    }
+
+    // Number of elements the list can hold before it allocates again.
+    [[nodiscard]]
+    constexpr std::size_t capacity() const {
+        return size_ + pool_.available();
+    }
+
+    // Bytes owned by the list itself: the list object, its nodes, the spare
+    // nodes of its pool, the positional index and the lookup table. Memory
+    // owned by the elements is not counted, nor is the allocator's
+    // per-allocation overhead.
+    [[nodiscard]]
+    constexpr std::size_t memory_usage() const {
+        return sizeof(LinkedList) + pool_.bytes() + index_.bytes() +
+               lookup_.bytes();
+    }
+
+    // As memory_usage(), plus `element_bytes(element)` for every element:
+    // the memory an element owns beyond sizeof(T), e.g. a string's buffer.
+    template <typename ElementBytes>
+        requires std::is_invocable_r_v<std::size_t, ElementBytes&,
+                                       const_reference>
+    [[nodiscard]]
+    constexpr std::size_t memory_usage(ElementBytes element_bytes) const {
+        auto bytes = memory_usage();
+        for (auto current{root_}; current; current = current->next) {
+            bytes += element_bytes(std::as_const(current->data));
+        }
+        return bytes;
     }
 
     [[nodiscard]]
     constexpr std::size_t size() const { return size_; };
 
+    [[nodiscard]]
+    constexpr const Stats& stats() const { return stats_; }
+
+    constexpr void reset_stats() { stats_ = Stats{}; }
+
     [[nodiscard]]
     constexpr auto begin() { return iterator{root_}; }
 
@@ -165,12 +761,51 @@ public:
     [[nodiscard]]
     constexpr auto end() const { return const_iterator{nullptr}; }
 
+    [[nodiscard]]
+    constexpr auto cbegin() const { return begin(); }
+
+    [[nodiscard]]
+    constexpr auto cend() const { return end(); }
+
     [[nodiscard]]
     constexpr auto is_empty() const { return root_ == nullptr; }
 
+    // Average O(1) with HashLookup, O(n) otherwise.
     [[nodiscard]]
     constexpr auto contains(const_reference value) const {
-        return std::find(begin(), end(), value) != end();
+        if constexpr (Lookup::enabled) {
+            if (lookup_.valid()) {
+                const auto found = lookup_.find(value, root_).has_value();
+                stats_.visited(LinkedListOp::Contains, found ? 1 : 0);
+                return found;
+            }
+        }
+        if constexpr (Traversal::distance == 0 && !Stats::enabled) {
+            return std::find(begin(), end(), value) != end();
+        } else {
+            std::size_t visited{};
+            lookahead ahead{root_};
+            for (auto current{root_}; current;
+                    current = current->next, ahead.advance()) {
+                ++visited;
+                if (current->data == value) {
+                    stats_.visited(LinkedListOp::Contains, visited);
+                    return true;
+                }
+            }
+            stats_.visited(LinkedListOp::Contains, visited);
+            return false;
+        }
+    }
+
+    // Number of elements equal to `value`: average O(1 + count) with
+    // HashLookup, O(n) otherwise.
+    [[nodiscard]]
+    constexpr std::size_t count(const_reference value) const {
+        if constexpr (Lookup::enabled) {
+            if (lookup_.valid()) return lookup_.count(value, root_);
+        }
+        return static_cast<std::size_t>(std::count(begin(), end(), value));
     }
 
     [[nodiscard]]
@@ -207,49 +842,227 @@ public:
         return std::unexpected(last.error());
     }
 
-    void push_front(value_type data) {
-        const auto next = root_;
-        root_ = new node{std::move(data), next};
+    // Element at `position`: O(position), or O(sqrt(n)) with BlockIndex.
+    // A stale index is rebuilt by the non-const overloads only; the const
+    // ones walk instead, so that they stay safe to call concurrently.
+    [[nodiscard]]
+    constexpr std::expected<std::reference_wrapper<value_type>,
+                            LinkedListError>
+    at(std::size_t position) {
+        if (position >= size_) {
+            return std::unexpected(LinkedListError::OutOfRange);
+        }
+        return node_at(position)->data;
+    }
+
+    [[nodiscard]]
+    constexpr std::expected<std::reference_wrapper<const value_type>,
+                            LinkedListError>
+    at(std::size_t position) const {
+        if (position >= size_) {
+            return std::unexpected(LinkedListError::OutOfRange);
+        }
+        return walk_to(position).first->data;
+    }
+
+    // Iterator to the element at `position`, or end() past the last one.
+    [[nodiscard]]
+    constexpr iterator iterator_at(std::size_t position) {
+        if (position >= size_) return end();
+        return iterator{node_at(position)};
+    }
+
+    [[nodiscard]]
+    constexpr const_iterator iterator_at(std::size_t position) const {
+        if (position >= size_) return end();
+        return const_iterator{walk_to(position).first};
+    }
+
+    // Inserts a new element so that it ends up at `position`, which may be
+    // size(), and returns an iterator to it.
+    template <typename... Args>
+    constexpr std::expected<iterator, LinkedListError>
+    emplace_at(std::size_t position, Args&&... args) {
+        if (position > size_) {
+            return std::unexpected(LinkedListError::OutOfRange);
+        }
+        if (position == 0) {
+            emplace_front(std::forward<Args>(args)...);
+            return begin();
+        }
+
+        const auto prev = node_at(position - 1);
+        const auto new_node = create_node(
+            std::in_place, prev->next, std::forward<Args>(args)...);
+        look_up_new(new_node, new_node, prev, prev->next);
+        prev->next = new_node;
+        if (prev == tail_) tail_ = new_node;
+        ++size_;
+        note_size();
+        index_.inserted(position, new_node, root_, size_);
+        return iterator{new_node};
+    }
+
+    constexpr std::expected<iterator, LinkedListError>
+    insert_at(std::size_t position, value_type data) {
+        return emplace_at(position, std::move(data));
+    }
+
+    // Erases the element at `position` and returns an iterator to the one
+    // that took its place.
+    constexpr std::expected<iterator, LinkedListError>
+    erase_at(std::size_t position) {
+        if (position >= size_) {
+            return std::unexpected(LinkedListError::OutOfRange);
+        }
+        if (position == 0) {
+            pop_front();
+            return begin();
+        }
+
+        const auto prev   = node_at(position - 1);
+        const auto victim = prev->next;
+        lookup_.unlinking(victim, prev);
+        prev->next = victim->next;
+        if (victim == tail_) tail_ = prev;
+        destroy_node(victim);
+        --size_;
+        index_.erased(position, prev->next);
+        return iterator{prev->next};
+    }
+
+    constexpr void push_front(value_type data) {
+        emplace_front(std::move(data));
+    }
+
+    template <typename... Args>
+    constexpr reference emplace_front(Args&&... args) {
+        const auto new_node =
+            create_node(std::in_place, root_, std::forward<Args>(args)...);
+        look_up_new(new_node, new_node, nullptr, root_);
+        if (!root_) tail_ = new_node;
+        root_ = new_node;
         ++size_;
+        note_size();
+        index_.inserted(0, root_, root_, size_);
+        return root_->data;
     }
 
-    void pop_front() {
+    // Appends the elements of `range` in order. After reserve() a range of
+    // known size gets its nodes in one block of the pool.
+    template <std::ranges::input_range R>
+    constexpr void append_range(R&& range) {
+        const auto [first, last, count] = make_chain(std::forward<R>(range));
+        if (!first) return;
+
+        look_up_new(first, last, tail_, nullptr);
+        if (tail_) {
+            tail_->next = first;
+        } else {
+            root_ = first;
+        }
+        tail_  = last;
+        size_ += count;
+        note_size();
+        index_.invalidate();
+    }
+
+    // Inserts the elements of `range` in order before the first element.
+    template <std::ranges::input_range R>
+    constexpr void prepend_range(R&& range) {
+        const auto [first, last, count] = make_chain(std::forward<R>(range));
+        if (!first) return;
+
+        look_up_new(first, last, nullptr, root_);
+        last->next = root_;
+        root_ = first;
+        if (!tail_) tail_ = last;
+        size_ += count;
+        note_size();
+        index_.invalidate();
+    }
+
+    constexpr void pop_front() {
         if (!root_) return;
 
+        lookup_.unlinking(root_, nullptr);
         const auto next = root_->next;
-        delete root_;
+        destroy_node(root_);
         root_ = next;
+        if (!next) tail_ = nullptr;
         --size_;
+        index_.erased(0, root_);
     }
 
-    void push_back(value_type data) {
-        const auto new_node = new node{std::move(data)};
+    constexpr void push_back(value_type data) {
+        emplace_back(std::move(data));
+    }
 
-        auto last = get_last();
-        if (last) {
-            last.value()->next = new_node;
+    template <typename... Args>
+    constexpr reference emplace_back(Args&&... args) {
+        const auto new_node =
+            create_node(std::in_place, nullptr, std::forward<Args>(args)...);
+        look_up_new(new_node, new_node, tail_, nullptr);
+
+        if (tail_) {
+            tail_->next = new_node;
         } else {
             root_ = new_node;
         }
+        tail_ = new_node;
         ++size_;
+        note_size();
+        index_.inserted(size_ - 1, new_node, root_, size_);
+        return new_node->data;
     }
 
-    void pop_back() {
+    // Inserts a new element right after `pos`, which must point to an
+    // element of this list, and returns an iterator to it.
+    template <typename... Args>
+    constexpr iterator emplace_after(const_iterator pos, Args&&... args) {
+        const auto prev = const_cast<node_pointer>(pos.current_);
+        const auto new_node = create_node(
+            std::in_place, prev->next, std::forward<Args>(args)...);
+        look_up_new(new_node, new_node, prev, prev->next);
+
+        prev->next = new_node;
+        ++size_;
+        note_size();
+        if (prev == tail_) {
+            tail_ = new_node;
+            index_.inserted(size_ - 1, new_node, root_, size_);
+        } else {
+            // The position of `pos` is not known.
+            index_.invalidate();
+        }
+        return iterator{new_node};
+    }
+
+    constexpr void pop_back() {
         if (!root_) return;
 
         if (!root_->next) {
-            delete root_;
+            stats_.visited(LinkedListOp::PopBack, 1);
+            destroy_node(root_);
             root_ = nullptr;
+            tail_ = nullptr;
             --size_;
+            index_.clear();
+            lookup_.clear();
             return;
         }
 
-        auto prev    = root_;
-        auto current = root_->next;
-        for (; current->next; prev = current, current = current->next);
-        delete current;
+        // Singly linked: the predecessor of the tail still has to be found,
+        // by a walk from the front or from the nearest indexed node.
+        if (!index_.valid()) reindex_positions();
+        const auto [prev, steps] = walk_to(size_ - 2);
+        stats_.visited(LinkedListOp::PopBack, steps + 2);
+        lookup_.unlinking(tail_, prev);
+        destroy_node(tail_);
         prev->next = nullptr;
+        tail_ = prev;
         --size_;
+        index_.erased(size_, nullptr);
     }
 
     friend constexpr auto operator==(
@@ -260,45 +1073,77 @@ public:
 
     friend std::ostream& operator<<(std::ostream& os, const LinkedList& ll) {
         os << "[";
-        std::for_each(std::begin(ll), std::end(ll), [&os](const auto element) {
+        std::for_each(std::begin(ll), std::end(ll), [&os](const auto& element) {
             os << element << " -> "; });
         os << "NULL]";
         return os;
     };
 
-    void remove(const_reference data) {
-        if (!root_) return;
+    // Removes the first element equal to `data`; with HashLookup, some
+    // element equal to it, found in average O(1).
+    constexpr void remove(const_reference data) {
+        if constexpr (Lookup::enabled) {
+            restore_lookup();
+            const auto prev = lookup_.find(data, root_);
+            stats_.visited(LinkedListOp::Remove, prev ? 1 : 0);
+            if (prev) erase_after(*prev);
+            return;
+        }
+
+        if (!root_) {
+            stats_.visited(LinkedListOp::Remove, 0);
+            return;
+        }
 
         if (root_->data == data) {
-            const auto next = root_->next;
-            delete root_;
-            --size_;
-            root_ = next;
+            stats_.visited(LinkedListOp::Remove, 1);
+            pop_front();
+            return;
         }
 
+        std::size_t visited{1};
         auto prev = root_;
         for (auto current{root_->next}; current;
                 prev = current, current = current->next) {
+            ++visited;
             if (current->data == data) {
                 prev->next = current->next;
-                delete current;
+                if (current == tail_) tail_ = prev;
+                destroy_node(current);
                 --size_;
+                index_.erased(visited - 1, prev->next);
                 break;
             }
         }
+        stats_.visited(LinkedListOp::Remove, visited);
     }
 
-    void remove_all(const_reference data) {
+    // O(n), or average O(1 + removed) with HashLookup.
+    constexpr void remove_all(const_reference data) {
+        if constexpr (Lookup::enabled) {
+            restore_lookup();
+            std::size_t removed{};
+            for (auto prev{lookup_.find(data, root_)}; prev;
+                    prev = lookup_.find(data, root_)) {
+                erase_after(*prev);
+                ++removed;
+            }
+            stats_.visited(LinkedListOp::RemoveAll, removed);
+            return;
+        }
+
+        stats_.visited(LinkedListOp::RemoveAll, size_);
         if (!root_) return;
 
         node_pointer prev{nullptr};
-        auto current = root_;;
+        auto current = root_;
+        lookahead ahead{root_};
 
-        while (current) {
+        for (; current; ahead.advance()) {
             if (current->data == data) {
                 const auto next = current->next;
 
-                delete current;
+                destroy_node(current);
                 --size_;
 
                 if (!prev) {
@@ -313,23 +1158,409 @@ public:
             prev    = current;
             current = current->next;
         }
+        tail_ = prev;
+        reindex();
+    }
+
+    constexpr void sort() { sort(std::less<>{}); }
+
+    // Stable merge sort that only relinks nodes: no element is moved and
+    // nothing is allocated. bins[i] holds a sorted run of 2^i nodes, so
+    // bins[i] always holds elements that came before those of lower bins.
+    template <typename Compare>
+    constexpr void sort(Compare comp) {
+        if (size_ < 2) return;
+
+        lookup_.invalidate();
+        node_pointer bins[std::numeric_limits<std::size_t>::digits]{};
+        for (node_pointer current{root_}; current;) {
+            node_pointer run{current};
+            current   = current->next;
+            run->next = nullptr;
+
+            std::size_t i{};
+            for (; bins[i]; ++i) {
+                run     = merge_chains(bins[i], run, comp);
+                bins[i] = nullptr;
+            }
+            bins[i] = run;
+        }
+
+        node_pointer sorted{nullptr};
+        for (const auto bin : bins) {
+            if (bin) sorted = merge_chains(bin, sorted, comp);
+        }
+        root_ = sorted;
+        update_tail();
+        reindex();
+    }
+
+    constexpr void merge(LinkedList&& other) {
+        merge(std::move(other), std::less<>{});
+    }
+
+    // Merges the sorted `other` into this sorted list in linear time by
+    // relinking nodes; equal elements of this list come first. `other` is
+    // left empty.
+    template <typename Compare>
+    constexpr void merge(LinkedList&& other, Compare comp) {
+        if (this == &other) return;
+
+        auto source = adoptable(std::move(other));
+        if (!source.root_) return;
+
+        pool_.take_all_nodes(source.pool_);
+        lookup_.invalidate();
+        root_  = merge_chains(root_, source.root_, comp);
+        size_ += source.size_;
+        note_size();
+        if (!tail_ || (source.tail_ && !comp(source.tail_->data, tail_->data))) {
+            tail_ = source.tail_;
+        }
+        source.root_ = source.tail_ = nullptr;
+        source.size_ = 0;
+        source.index_.clear();
+        source.lookup_.clear();
+        reindex();
+    }
+
+    // Moves all elements of `other` right after `pos`, which must point to
+    // an element of this list. Nodes are relinked in O(1) whenever this
+    // list can take them over (see merge()).
+    constexpr void splice_after(const_iterator pos, LinkedList& other) {
+        if (this == &other || !other.root_) return;
+
+        if (!can_adopt_nodes_of(other)) {
+            for (auto& element : other) {
+                pos = emplace_after(pos, std::move(element));
+            }
+            other.clear();
+            return;
+        }
+
+        const auto dest = node_of(pos);
+        lookup_.linking_chain(other.root_, other.tail_, dest, dest->next);
+        other.tail_->next = dest->next;
+        dest->next = other.root_;
+        if (dest == tail_) tail_ = other.tail_;
+
+        size_ += other.size_;
+        note_size();
+        pool_.take_all_nodes(other.pool_);
+        other.root_ = other.tail_ = nullptr;
+        other.size_ = 0;
+        other.index_.clear();
+        other.lookup_.clear();
+        index_.invalidate();
+    }
+
+    constexpr void splice_after(const_iterator pos, LinkedList&& other) {
+        splice_after(pos, other);
+    }
+
+    // Moves the elements in the open range (first, last) of `other`, which
+    // may be this list, right after `pos`. `pos` must not lie inside the
+    // range. Relinking costs O(1) plus counting the moved nodes.
+    constexpr void splice_after(const_iterator pos, LinkedList& other,
+                                const_iterator first, const_iterator last) {
+        const auto before = node_of(first);
+        const auto end    = node_of(last);
+        if (before->next == end || node_of(pos) == before) return;
+
+        if (this != &other && !can_adopt_some_nodes_of(other)) {
+            for (auto current{before->next}; current != end;
+                    current = current->next) {
+                pos = emplace_after(pos, std::move(current->data));
+            }
+            other.erase_between(before, end);
+            return;
+        }
+
+        const auto first_moved = before->next;
+        auto last_moved = first_moved;
+        std::size_t count{1};
+        for (; last_moved->next != end; last_moved = last_moved->next) {
+            ++count;
+        }
+        const auto dest = node_of(pos);
+        if constexpr (Lookup::enabled) {
+            if (this == &other) {
+                lookup_.moving(first_moved, last_moved, before, dest,
+                               dest->next);
+            } else {
+                lookup_.linking_chain(first_moved, last_moved, dest,
+                                      dest->next);
+                for (auto current{first_moved}; current != end;
+                        current = current->next) {
+                    other.lookup_.unlinking(current, before);
+                }
+            }
+        }
+
+        before->next = end;
+        if (other.tail_ == last_moved) other.tail_ = before;
+
+        last_moved->next = dest->next;
+        dest->next = first_moved;
+        if (dest == tail_) tail_ = last_moved;
+
+        if (this != &other) {
+            other.size_ -= count;
+            size_       += count;
+            pool_.take_nodes(other.pool_, count);
+            note_size();
+        }
+        other.index_.invalidate();
+        index_.invalidate();
+    }
+
+    constexpr void splice_after(const_iterator pos, LinkedList&& other,
+                                const_iterator first, const_iterator last) {
+        splice_after(pos, other, first, last);
+    }
+
+    // Moves all elements of `other` to the end of this list; O(1) when the
+    // nodes can be relinked.
+    constexpr void append(LinkedList&& other) {
+        if (this == &other || !other.root_) return;
+
+        if (!root_ && can_adopt_nodes_of(other)) {
+            pool_.take_all_nodes(other.pool_);
+            root_ = std::exchange(other.root_, nullptr);
+            tail_ = std::exchange(other.tail_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            note_size();
+            other.index_.clear();
+            index_.invalidate();
+            swap(lookup_, other.lookup_);
+            other.lookup_.clear();
+            return;
+        }
+        if (!root_) {
+            for (auto& element : other) {
+                push_back(std::move(element));
+            }
+            other.clear();
+            return;
+        }
+        splice_after(const_iterator{tail_}, other);
+    }
+
+    // Cuts the list after `pos`, which must point to an element of this
+    // list, and returns the cut-off elements as a new list. Costs a walk
+    // over the returned part to count it.
+    [[nodiscard]]
+    constexpr LinkedList split_after(const_iterator pos) {
+        LinkedList result(get_allocator());
+
+        const auto last_kept = node_of(pos);
+        if (!last_kept->next) return result;
+
+        if (!pool_.can_transfer_nodes()) {
+            // The nodes belong to this list's pool chunks or blocks.
+            for (auto current{last_kept->next}; current;
+                    current = current->next) {
+                result.push_back(std::move(current->data));
+            }
+            erase_between(last_kept, nullptr);
+            return result;
+        }
+
+        // The new list's lookup table is built before anything is relinked,
+        // so that if it throws this list is left as it was.
+        std::size_t count{};
+        for (auto current{last_kept->next}; current; current = current->next) {
+            ++count;
+        }
+        result.lookup_.rebuild(last_kept->next, count);
 
+        result.root_ = last_kept->next;
+        result.tail_ = tail_;
+        result.size_ = count;
+        for (auto current{result.root_}; current; current = current->next) {
+            lookup_.unlinking(current, last_kept);
+        }
+        result.pool_.take_nodes(pool_, result.size_);
+        result.index_.invalidate();
+
+        last_kept->next = nullptr;
+        tail_  = last_kept;
+        size_ -= result.size_;
+        index_.invalidate();
+        return result;
+    }
+
+    constexpr std::size_t unique() { return unique(std::equal_to<>{}); }
+
+    // Removes every element equal (by `pred`) to the one before it and
+    // returns how many were removed.
+    template <typename BinaryPredicate>
+    constexpr std::size_t unique(BinaryPredicate pred) {
+        if (!root_) return 0;
+
+        std::size_t  removed{};
+        node_pointer current{root_};
+        while (current->next) {
+            const auto next = current->next;
+            if (pred(current->data, next->data)) {
+                lookup_.unlinking(next, current);
+                current->next = next->next;
+                destroy_node(next);
+                ++removed;
+            } else {
+                current = next;
+            }
+        }
+        tail_  = current;
+        size_ -= removed;
+        reindex_positions();
+        return removed;
     }
 };
 
+template <std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel,
+          typename Allocator = std::allocator<std::iter_value_t<InputIt>>>
+LinkedList(InputIt, Sentinel, Allocator = Allocator())
+    -> LinkedList<std::iter_value_t<InputIt>, Allocator>;
+
+template <std::ranges::input_range R,
+          typename Allocator = std::allocator<std::ranges::range_value_t<R>>>
+LinkedList(std::from_range_t, R&&, Allocator = Allocator())
+    -> LinkedList<std::ranges::range_value_t<R>, Allocator>;
+
+// LinkedList with O(sqrt(n)) positional access.
+template <typename T, typename Allocator = std::allocator<T>>
+using IndexedLinkedList =
+    LinkedList<T, Allocator, SequentialTraversal, NoStats, BlockIndex>;
+
+// LinkedList with average O(1) contains(), count() and remove().
+template <typename T, typename Allocator = std::allocator<T>,
+          typename Key = std::identity>
+using HashedLinkedList = LinkedList<T, Allocator, SequentialTraversal,
+                                    NoStats, NoIndex, HashLookup<Key>>;
+
+namespace pmr {
+template <typename T, typename Traversal = SequentialTraversal,
+          typename Stats = NoStats, typename Index = NoIndex,
+          typename Lookup = NoLookup>
+using LinkedList = ::LinkedList<T, std::pmr::polymorphic_allocator<T>,
+                                Traversal, Stats, Index, Lookup>;
+
+template <typename T>
+using IndexedLinkedList =
+    ::IndexedLinkedList<T, std::pmr::polymorphic_allocator<T>>;
+
+template <typename T, typename Key = std::identity>
+using HashedLinkedList =
+    ::HashedLinkedList<T, std::pmr::polymorphic_allocator<T>, Key>;
+}
+
+// Formats any of the list containers holding T as "[1 -> 2 -> NULL]".
+//
+// The format spec is [n][.count][:element-spec]:
+//   n             leaves out the brackets
+//   .count        prints at most `count` elements; a longer list ends in
+//                 "..." instead of the terminator, e.g. "[1 -> 2 -> ...]"
+//   element-spec  is passed to std::formatter<T>, e.g. {::#x}
+//
+// The separator, the brackets and the terminator ("NULL") can be changed by
+// a formatter deriving from this one, as with std::range_formatter. The
+// terminator is printed as the last item; an empty one is left out.
+//
+// The output goes straight to the format context: the constant parts are
+// copied and the elements formatted in place, with no temporary strings.
 template <typename T>
-struct std::formatter<LinkedList<T>> {
+class LinkedListFormatter {
+    std::formatter<T> underlying_;
+    std::string_view  separator_{" -> "};
+    std::string_view  opening_bracket_{"["};
+    std::string_view  closing_bracket_{"]"};
+    std::string_view  terminator_{"NULL"};
+    bool              brackets_{true};
+    std::size_t       limit_{std::numeric_limits<std::size_t>::max()};
+
+    template <typename Out>
+    static Out put(std::string_view text, Out out) {
+        return std::copy(text.begin(), text.end(), std::move(out));
+    }
+
+public:
+    constexpr void set_separator(std::string_view separator) {
+        separator_ = separator;
+    }
+
+    constexpr void set_brackets(std::string_view opening,
+                                std::string_view closing) {
+        opening_bracket_ = opening;
+        closing_bracket_ = closing;
+    }
+
+    constexpr void set_terminator(std::string_view terminator) {
+        terminator_ = terminator;
+    }
+
+    [[nodiscard]]
+    constexpr auto& underlying() { return underlying_; }
+
+    [[nodiscard]]
+    constexpr const auto& underlying() const { return underlying_; }
+
     constexpr auto parse(std::format_parse_context& ctx) {
-        return ctx.begin();
+        auto it = ctx.begin();
+        const auto end = ctx.end();
+
+        if (it != end && *it == 'n') {
+            brackets_ = false;
+            ++it;
+        }
+        if (it != end && *it == '.') {
+            ++it;
+            if (it == end || *it < '0' || *it > '9') {
+                throw std::format_error("missing count in list format spec");
+            }
+            limit_ = 0;
+            for (; it != end && *it >= '0' && *it <= '9'; ++it) {
+                limit_ = limit_ * 10 + static_cast<std::size_t>(*it - '0');
+            }
+        }
+        if (it != end && *it == ':') ++it;
+        else if (it != end && *it != '}') {
+            throw std::format_error("invalid list format spec");
+        }
+
+        ctx.advance_to(it);
+        return underlying_.parse(ctx);
     }
 
-    auto format(const LinkedList<T>& ll, std::format_context& ctx) const {
-        const auto& out = ctx.out();
-        std::format_to(out, "[");
-        std::for_each(std::begin(ll), std::end(ll), [&out](const auto& element)
-            { std::format_to(out, "{} {} ", element, "->"); });
-        std::format_to(out, "NULL");
-        return std::format_to(out, "]");
+    template <typename List, typename FormatContext>
+    auto format(const List& ll, FormatContext& ctx) const {
+        auto out = ctx.out();
+        if (brackets_) out = put(opening_bracket_, std::move(out));
+
+        auto end_item = terminator_;
+        std::size_t printed{};
+        for (const auto& element : ll) {
+            if (printed == limit_) {
+                end_item = "...";
+                break;
+            }
+            if (printed++ != 0) out = put(separator_, std::move(out));
+            ctx.advance_to(std::move(out));
+            out = underlying_.format(element, ctx);
+        }
+        if (!end_item.empty()) {
+            if (printed != 0) out = put(separator_, std::move(out));
+            out = put(end_item, std::move(out));
+        }
+
+        if (brackets_) out = put(closing_bracket_, std::move(out));
+        return out;
     }
 };
 
+template <typename T, typename Allocator, typename Traversal, typename Stats,
+          typename Index, typename Lookup>
+struct std::formatter<
+    LinkedList<T, Allocator, Traversal, Stats, Index, Lookup>>
+    : LinkedListFormatter<T> {};
+
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+
+// Memory resource that counts the bytes going through it and forwards the
+// requests to an upstream resource. Give one resource to a group of pmr
+// lists to account for them together, or install it with
+// std::pmr::set_default_resource() to account for every pmr container that
+// uses the default resource. Counting is thread-safe.
+class ByteCountingResource : public std::pmr::memory_resource {
+    std::pmr::memory_resource* upstream_;
+
+    std::atomic<std::size_t> bytes_in_use_{};
+    std::atomic<std::size_t> peak_bytes_{};
+    std::atomic<std::size_t> allocations_{};
+    std::atomic<std::size_t> bytes_allocated_{};
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        const auto pointer = upstream_->allocate(bytes, alignment);
+
+        allocations_.fetch_add(1, std::memory_order_relaxed);
+        bytes_allocated_.fetch_add(bytes, std::memory_order_relaxed);
+        const auto in_use =
+            bytes_in_use_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        auto peak = peak_bytes_.load(std::memory_order_relaxed);
+        while (in_use > peak && !peak_bytes_.compare_exchange_weak(
+                   peak, in_use, std::memory_order_relaxed));
+        return pointer;
+    }
+
+    void do_deallocate(void* pointer, std::size_t bytes,
+                       std::size_t alignment) override {
+        upstream_->deallocate(pointer, bytes, alignment);
+        bytes_in_use_.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    bool do_is_equal(
+            const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+public:
+    explicit ByteCountingResource(
+            std::pmr::memory_resource* upstream =
+                std::pmr::get_default_resource())
+        : upstream_{upstream} {}
+
+    ByteCountingResource(const ByteCountingResource&)            = delete;
+    ByteCountingResource& operator=(const ByteCountingResource&) = delete;
+
+    [[nodiscard]]
+    std::pmr::memory_resource* upstream_resource() const {
+        return upstream_;
+    }
+
+    // Bytes allocated and not deallocated yet.
+    [[nodiscard]]
+    std::size_t bytes_in_use() const {
+        return bytes_in_use_.load(std::memory_order_relaxed);
+    }
+
+    // Highest bytes_in_use() since construction or reset_peak().
+    [[nodiscard]]
+    std::size_t peak_bytes() const {
+        return peak_bytes_.load(std::memory_order_relaxed);
+    }
+
+    // Number and total size of all allocations so far.
+    [[nodiscard]]
+    std::size_t allocations() const {
+        return allocations_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]]
+    std::size_t bytes_allocated() const {
+        return bytes_allocated_.load(std::memory_order_relaxed);
+    }
+
+    void reset_peak() {
+        peak_bytes_.store(bytes_in_use(), std::memory_order_relaxed);
+    }
+};
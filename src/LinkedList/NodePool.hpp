@@ -0,0 +1,346 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+
+// Per-container storage for nodes. Until reserve() is called every node is
+// allocated and freed on its own, exactly as with the bare allocator. After
+// reserve() the pool switches to recycling: nodes come from chunks obtained
+// from the allocator and freed nodes are put on a free list for reuse.
+//
+// Independently of recycling, allocate_block() hands out many nodes from
+// one allocation. Such a block is never reused; it goes back to the
+// allocator once its last node is deallocated.
+//
+// The pool does not own the allocator; the owning container passes its node
+// allocator to every call.
+template <typename Node, typename NodeAllocator>
+class NodePool {
+    using node_pointer = Node*;
+    using node_traits  = std::allocator_traits<NodeAllocator>;
+
+    // A free node slot holds no Node, only the link to the next free slot.
+    struct free_slot {
+        free_slot* next;
+    };
+
+    struct chunk {
+        node_pointer nodes;
+        std::size_t  count;
+        chunk*       next;
+        // Nodes of a block not deallocated yet; unused for chunks.
+        std::size_t  live{};
+    };
+
+    using chunk_allocator =
+        typename node_traits::template rebind_alloc<chunk>;
+    using chunk_traits    = std::allocator_traits<chunk_allocator>;
+
+    static_assert(sizeof(Node)  >= sizeof(free_slot));
+    static_assert(alignof(Node) >= alignof(free_slot));
+
+    static constexpr std::size_t min_chunk_size{16};
+
+    free_slot*  free_{};
+    std::size_t available_{};
+    chunk*      chunks_{};
+    std::size_t pooled_{};
+    chunk*      blocks_{};
+    // Nodes allocated one by one that have not been deallocated yet. While
+    // it is zero every free slot is known to belong to a chunk.
+    std::size_t singles_{};
+    bool        recycling_{};
+
+    void push_free(node_pointer n) {
+        free_ = ::new (static_cast<void*>(n)) free_slot{free_};
+        ++available_;
+    }
+
+    node_pointer pop_free() {
+        const auto slot = free_;
+        free_ = slot->next;
+        --available_;
+        return reinterpret_cast<node_pointer>(slot);
+    }
+
+    static chunk* new_chunk(NodeAllocator& alloc, std::size_t count,
+                            chunk* next) {
+        chunk_allocator chunk_alloc(alloc);
+        const auto c = chunk_traits::allocate(chunk_alloc, 1);
+        try {
+            c->nodes = node_traits::allocate(alloc, count);
+        } catch (...) {
+            chunk_traits::deallocate(chunk_alloc, c, 1);
+            throw;
+        }
+        c->count = count;
+        c->next  = next;
+        c->live  = 0;
+        return c;
+    }
+
+    static void delete_chunk(NodeAllocator& alloc, chunk* c) {
+        chunk_allocator chunk_alloc(alloc);
+        node_traits::deallocate(alloc, c->nodes, c->count);
+        chunk_traits::deallocate(chunk_alloc, c, 1);
+    }
+
+    void add_chunk(NodeAllocator& alloc, std::size_t count) {
+        const auto added = new_chunk(alloc, count, chunks_);
+        chunks_  = added;
+        pooled_ += count;
+
+        // Pushed back to front so that the nodes are handed out in
+        // address order.
+        for (std::size_t i{count}; i > 0; --i) {
+            push_free(added->nodes + (i - 1));
+        }
+    }
+
+    void free_chunk(NodeAllocator& alloc, chunk* c) {
+        pooled_ -= c->count;
+        delete_chunk(alloc, c);
+    }
+
+    [[nodiscard]]
+    static bool in_chunk(const chunk* c, const void* slot) {
+        const auto address = static_cast<const Node*>(slot);
+        return std::less_equal<>{}(c->nodes, address) &&
+               std::less<>{}(address, c->nodes + c->count);
+    }
+
+    // Counts `n` as deallocated if it belongs to a block and frees the
+    // block with its last node. Returns whether it did.
+    bool release_from_block(NodeAllocator& alloc, node_pointer n) {
+        for (chunk** link{&blocks_}; *link; link = &(*link)->next) {
+            const auto b = *link;
+            if (!in_chunk(b, n)) continue;
+
+            if (--b->live == 0) {
+                *link = b->next;
+                delete_chunk(alloc, b);
+            }
+            return true;
+        }
+        return false;
+    }
+
+    [[nodiscard]]
+    chunk* find_chunk(const free_slot* slot) const {
+        for (auto c{chunks_}; c; c = c->next) {
+            if (in_chunk(c, slot)) return c;
+        }
+        return nullptr;
+    }
+
+public:
+    constexpr NodePool() = default;
+
+    NodePool(const NodePool&)            = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    constexpr NodePool(NodePool&& other) noexcept
+        : free_{std::exchange(other.free_, nullptr)},
+          available_{std::exchange(other.available_, 0)},
+          chunks_{std::exchange(other.chunks_, nullptr)},
+          pooled_{std::exchange(other.pooled_, 0)},
+          blocks_{std::exchange(other.blocks_, nullptr)},
+          singles_{std::exchange(other.singles_, 0)},
+          recycling_{std::exchange(other.recycling_, false)}
+    {}
+
+    NodePool& operator=(NodePool&&) = delete;
+
+    friend constexpr void swap(NodePool& p1, NodePool& p2) noexcept {
+        using std::swap;
+        swap(p1.free_, p2.free_);
+        swap(p1.available_, p2.available_);
+        swap(p1.chunks_, p2.chunks_);
+        swap(p1.pooled_, p2.pooled_);
+        swap(p1.blocks_, p2.blocks_);
+        swap(p1.singles_, p2.singles_);
+        swap(p1.recycling_, p2.recycling_);
+    }
+
+    [[nodiscard]]
+    constexpr bool recycling() const { return recycling_; }
+
+    // Number of free node slots kept for reuse.
+    [[nodiscard]]
+    constexpr std::size_t available() const { return available_; }
+
+    // Bytes obtained from the allocator: nodes in use or kept for reuse,
+    // chunks, blocks and their bookkeeping. Allocator overhead is not
+    // included.
+    [[nodiscard]]
+    constexpr std::size_t bytes() const {
+        std::size_t chunk_count{};
+        for (auto c{chunks_}; c; c = c->next) ++chunk_count;
+        std::size_t block_nodes{};
+        for (auto b{blocks_}; b; b = b->next) {
+            block_nodes += b->count;
+            ++chunk_count;
+        }
+        return (singles_ + pooled_ + block_nodes) * sizeof(Node) +
+               chunk_count * sizeof(chunk);
+    }
+
+    // Returns uninitialised storage for one Node.
+    constexpr node_pointer allocate(NodeAllocator& alloc) {
+        if (!recycling_) {
+            const auto n = node_traits::allocate(alloc, 1);
+            ++singles_;
+            return n;
+        }
+
+        if (!free_) {
+            add_chunk(alloc, std::max(min_chunk_size, pooled_));
+        }
+        return pop_free();
+    }
+
+    // Returns uninitialised storage for `count` Nodes, contiguous and in
+    // address order, obtained in one allocation. Each of them is given back
+    // through deallocate() as usual.
+    node_pointer allocate_block(NodeAllocator& alloc, std::size_t count) {
+        blocks_ = new_chunk(alloc, count, blocks_);
+        blocks_->live = count;
+        return blocks_->nodes;
+    }
+
+    // Takes back storage of a Node that was already destroyed.
+    constexpr void deallocate(NodeAllocator& alloc, node_pointer n) {
+        if (blocks_ && release_from_block(alloc, n)) return;
+        if (!recycling_) {
+            node_traits::deallocate(alloc, n, 1);
+            --singles_;
+            return;
+        }
+        push_free(n);
+    }
+
+    // Whether some of the nodes of this pool may be handed to another pool
+    // with the same allocator: true as long as they were all allocated one
+    // by one.
+    [[nodiscard]]
+    constexpr bool can_transfer_nodes() const {
+        return !recycling_ && !blocks_;
+    }
+
+    // Whether all nodes of this pool may be handed to another pool with the
+    // same allocator at once: blocks go along with them.
+    [[nodiscard]]
+    constexpr bool can_transfer_all_nodes() const { return !recycling_; }
+
+    // Records that `count` single nodes of `from` now belong to this pool.
+    constexpr void take_nodes(NodePool& from, std::size_t count) {
+        from.singles_ -= count;
+        singles_      += count;
+    }
+
+    // Records that all nodes of `from` now belong to this pool.
+    constexpr void take_all_nodes(NodePool& from) {
+        take_nodes(from, from.singles_);
+        if (!from.blocks_) return;
+
+        auto last = from.blocks_;
+        for (; last->next; last = last->next);
+        last->next = blocks_;
+        blocks_ = std::exchange(from.blocks_, nullptr);
+    }
+
+    // Makes sure at least `count` nodes can be allocated without going to
+    // the allocator, and turns recycling on.
+    void reserve(NodeAllocator& alloc, std::size_t count) {
+        recycling_ = true;
+        if (count > available_) {
+            add_chunk(alloc, count - available_);
+        }
+    }
+
+    // Adds one chunk of exactly `count` nodes and turns recycling on. The
+    // next `count` allocations are served from it, in address order.
+    void reserve_block(NodeAllocator& alloc, std::size_t count) {
+        recycling_ = true;
+        add_chunk(alloc, count);
+    }
+
+    // Gives back to the allocator every free node it can: nodes that were
+    // allocated on their own and chunks none of whose nodes are in use.
+    // Recycling stops once no chunk is left.
+    void shrink_to_fit(NodeAllocator& alloc) {
+        if (!recycling_) return;
+
+        if (singles_ != 0) {
+            for (free_slot** link{&free_}; *link;) {
+                const auto slot = *link;
+                if (find_chunk(slot)) {
+                    link = &slot->next;
+                    continue;
+                }
+                *link = slot->next;
+                --available_;
+                --singles_;
+                node_traits::deallocate(
+                    alloc, reinterpret_cast<node_pointer>(slot), 1);
+            }
+        }
+
+        for (chunk** chunk_link{&chunks_}; *chunk_link;) {
+            const auto c = *chunk_link;
+
+            std::size_t free_in_chunk{};
+            for (auto slot{free_}; slot; slot = slot->next) {
+                if (in_chunk(c, slot)) ++free_in_chunk;
+            }
+            if (free_in_chunk != c->count) {
+                chunk_link = &c->next;
+                continue;
+            }
+
+            for (free_slot** link{&free_}; *link;) {
+                if (in_chunk(c, *link)) {
+                    *link = (*link)->next;
+                    --available_;
+                } else {
+                    link = &(*link)->next;
+                }
+            }
+            *chunk_link = c->next;
+            free_chunk(alloc, c);
+        }
+
+        recycling_ = chunks_ != nullptr;
+    }
+
+    // Frees all storage. Every node must already have been deallocated.
+    constexpr void release(NodeAllocator& alloc) {
+        if (recycling_) {
+            if (singles_ != 0) {
+                for (auto slot{free_}; slot;) {
+                    const auto next = slot->next;
+                    if (!find_chunk(slot)) {
+                        node_traits::deallocate(
+                            alloc, reinterpret_cast<node_pointer>(slot), 1);
+                    }
+                    slot = next;
+                }
+            }
+            for (auto c{chunks_}; c;) {
+                const auto next = c->next;
+                free_chunk(alloc, c);
+                c = next;
+            }
+        }
+        free_      = nullptr;
+        available_ = 0;
+        chunks_    = nullptr;
+        pooled_    = 0;
+        singles_   = 0;
+        recycling_ = false;
+    }
+};
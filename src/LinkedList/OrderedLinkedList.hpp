@@ -0,0 +1,557 @@
+#pragma once
+
+#include "LinkedList/LinkedList.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <format>
+#include <ostream>
+#include <expected>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <type_traits>
+
+// Node of an OrderedLinkedList: the element and the number of levels the
+// node is linked into. The links for those levels are stored right after
+// the node, in the same allocation, so a node costs only as many links as
+// it has levels.
+template <typename T>
+struct SkipNode {
+    T           data;
+    std::size_t height;
+
+    template <typename... Args>
+    explicit SkipNode(std::size_t height, std::in_place_t, Args&&... args)
+        : data(std::forward<Args>(args)...), height{height} {}
+
+    [[nodiscard]]
+    SkipNode** links() {
+        return std::launder(reinterpret_cast<SkipNode**>(
+            reinterpret_cast<std::byte*>(this) + sizeof(SkipNode)));
+    }
+
+    // The node whose level 0 link is `link`.
+    [[nodiscard]]
+    static SkipNode* from_link(SkipNode** link) {
+        return std::launder(reinterpret_cast<SkipNode*>(
+            reinterpret_cast<std::byte*>(link) - sizeof(SkipNode)));
+    }
+};
+
+// Iterates over level 0, i.e. over every element in order. Elements are
+// only reachable as const: changing one could break the order.
+template <typename T>
+class OrderedLinkedListIterator {
+    using node_pointer = SkipNode<T>*;
+
+    node_pointer current_;
+
+    template <typename, typename, std::size_t, typename>
+    friend class OrderedLinkedList;
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const T*;
+    using reference         = const T&;
+
+    constexpr OrderedLinkedListIterator() : current_{nullptr} {}
+
+    explicit constexpr OrderedLinkedListIterator(node_pointer current)
+        : current_(current) {}
+
+    const T& operator*() const { return current_->data; }
+
+    const T* operator->() const { return &current_->data; }
+
+    OrderedLinkedListIterator& operator++() {
+        current_ = current_->links()[0];
+        return *this;
+    }
+
+    OrderedLinkedListIterator operator++(int) {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    friend constexpr bool operator==(const OrderedLinkedListIterator& lhs,
+                                     const OrderedLinkedListIterator& rhs) {
+        return lhs.current_ == rhs.current_;
+    }
+};
+
+// Sorted list kept as a skip list: level 0 links every element in order,
+// and each higher level links a random quarter of the nodes of the level
+// below. Searches start at the highest level and drop a level whenever the
+// next node would overshoot, so insert(), contains(), lower_bound() and
+// erase() take expected O(log n) steps. MaxLevel bounds the number of
+// levels; with 1/4 of the nodes promoted per level, 16 levels suit lists
+// of up to about 4^16 elements.
+//
+// Equivalent elements are allowed and kept in insertion order. Levels are
+// drawn from a generator with a fixed seed, so runs are reproducible.
+template <typename T, typename Compare = std::less<>,
+          std::size_t MaxLevel = 16, typename Allocator = std::allocator<T>>
+class OrderedLinkedList {
+    static_assert(MaxLevel >= 1 && MaxLevel <= 32,
+        "OrderedLinkedList supports 1 to 32 levels");
+
+    using node         = SkipNode<T>;
+    using node_pointer = node*;
+    using links        = std::array<node_pointer*, MaxLevel>;
+
+    // Allocation unit for a node and its links.
+    struct alignas(node) storage_unit {
+        std::byte bytes[alignof(node)];
+    };
+
+    using allocator_traits = std::allocator_traits<Allocator>;
+    using unit_allocator   =
+        typename allocator_traits::template rebind_alloc<storage_unit>;
+    using unit_traits      = std::allocator_traits<unit_allocator>;
+    using node_allocator   =
+        typename allocator_traits::template rebind_alloc<node>;
+    using node_traits      = std::allocator_traits<node_allocator>;
+
+    static_assert(
+        std::is_same_v<typename unit_traits::pointer, storage_unit*>,
+        "OrderedLinkedList supports only allocators with raw pointers");
+
+    std::array<node_pointer, MaxLevel> head_{};
+    node_pointer  tail_{};
+    std::size_t   size_{};
+    std::size_t   levels_{1};
+    std::uint64_t random_state_{0x9E3779B97F4A7C15};
+
+    [[no_unique_address]] Compare        comp_{};
+    [[no_unique_address]] unit_allocator alloc_{};
+
+    [[nodiscard]]
+    static constexpr std::size_t units(std::size_t height) {
+        const auto bytes = sizeof(node) + height * sizeof(node_pointer);
+        return (bytes + sizeof(storage_unit) - 1) / sizeof(storage_unit);
+    }
+
+    // 1 + the number of times a coin with 1/4 for heads came up heads.
+    std::size_t random_height() {
+        auto x = random_state_;
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        random_state_ = x;
+        const auto height =
+            static_cast<std::size_t>(std::countr_zero(x)) / 2 + 1;
+        return std::min(height, MaxLevel);
+    }
+
+    template <typename... Args>
+    node_pointer create_node(std::size_t height, Args&&... args) {
+        const auto storage = unit_traits::allocate(alloc_, units(height));
+        const auto new_node = reinterpret_cast<node_pointer>(storage);
+        try {
+            node_allocator construct_alloc(alloc_);
+            node_traits::construct(construct_alloc, new_node, height,
+                                   std::in_place, std::forward<Args>(args)...);
+        } catch (...) {
+            unit_traits::deallocate(alloc_, storage, units(height));
+            throw;
+        }
+        std::uninitialized_value_construct_n(new_node->links(), height);
+        return new_node;
+    }
+
+    void destroy_node(node_pointer n) {
+        const auto height = n->height;
+        node_allocator destroy_alloc(alloc_);
+        node_traits::destroy(destroy_alloc, n);
+        unit_traits::deallocate(
+            alloc_, reinterpret_cast<storage_unit*>(n), units(height));
+    }
+
+    [[nodiscard]]
+    node_pointer* head_links() const {
+        return const_cast<node_pointer*>(head_.data());
+    }
+
+    // Whether `element` comes before the searched position: before the
+    // first element equivalent to `value`, or with `AfterEquivalent` after
+    // the last one.
+    template <bool AfterEquivalent>
+    [[nodiscard]]
+    bool goes_before(const T& element, const T& value) const {
+        if constexpr (AfterEquivalent) {
+            return !comp_(value, element);
+        } else {
+            return comp_(element, value);
+        }
+    }
+
+    // Fills `update` with the link that leads to the searched position on
+    // every level in use.
+    template <bool AfterEquivalent>
+    void find_links(const T& value, links& update) const {
+        auto current = head_links();
+        for (auto level{levels_}; level-- > 0;) {
+            for (auto next{current[level]};
+                    next && goes_before<AfterEquivalent>(next->data, value);
+                    next = current[level]) {
+                current = next->links();
+            }
+            update[level] = &current[level];
+        }
+    }
+
+    // Unlinks and destroys `target`, to which every link in `update` up to
+    // its height leads.
+    void unlink(node_pointer target, const links& update) {
+        for (std::size_t level{}; level < target->height; ++level) {
+            *update[level] = target->links()[level];
+        }
+        if (target == tail_) {
+            tail_ = update[0] == head_links()
+                  ? nullptr
+                  : node::from_link(update[0]);
+        }
+        while (levels_ > 1 && !head_[levels_ - 1]) --levels_;
+        destroy_node(target);
+        --size_;
+    }
+
+    // Appends elements that are known to come after all present ones in
+    // O(1) each; `last` holds the last link of every level.
+    template <typename U>
+    void append_sorted(U&& value, links& last) {
+        const auto height   = random_height();
+        const auto new_node = create_node(height, std::forward<U>(value));
+        for (std::size_t level{}; level < height; ++level) {
+            *last[level] = new_node;
+            last[level]  = &new_node->links()[level];
+        }
+        levels_ = std::max(levels_, height);
+        tail_   = new_node;
+        ++size_;
+    }
+
+    [[nodiscard]]
+    links tail_links() const {
+        links last{};
+        for (std::size_t level{}; level < MaxLevel; ++level) {
+            last[level] = &head_links()[level];
+        }
+        return last;
+    }
+
+    void copy_from(const OrderedLinkedList& other) {
+        auto last = tail_links();
+        for (const auto& element : other) {
+            append_sorted(element, last);
+        }
+    }
+
+    void move_elements_from(OrderedLinkedList& other) {
+        auto last = tail_links();
+        for (auto current{other.head_[0]}; current;
+                current = current->links()[0]) {
+            append_sorted(std::move(current->data), last);
+        }
+        other.clear();
+    }
+
+    void steal_from(OrderedLinkedList& other) noexcept {
+        head_   = std::exchange(other.head_, {});
+        tail_   = std::exchange(other.tail_, nullptr);
+        size_   = std::exchange(other.size_, 0);
+        levels_ = std::exchange(other.levels_, 1);
+    }
+
+    friend struct std::formatter<OrderedLinkedList>;
+
+public:
+    using value_type      = T;
+    using reference       = const value_type&;
+    using const_reference = const value_type&;
+
+    using allocator_type  = Allocator;
+    using value_compare   = Compare;
+
+    using iterator        = OrderedLinkedListIterator<T>;
+    using const_iterator  = OrderedLinkedListIterator<T>;
+
+    OrderedLinkedList() = default;
+
+    explicit OrderedLinkedList(const Compare& comp,
+                               const Allocator& alloc = Allocator())
+        : comp_{comp}, alloc_{alloc} {}
+
+    explicit OrderedLinkedList(const Allocator& alloc) : alloc_{alloc} {}
+
+    OrderedLinkedList(std::initializer_list<T> elements,
+                      const Compare& comp = Compare(),
+                      const Allocator& alloc = Allocator())
+            : OrderedLinkedList(comp, alloc) {
+        try {
+            for (const auto& element : elements) {
+                insert(element);
+            }
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+    OrderedLinkedList(const OrderedLinkedList& other)
+        : OrderedLinkedList(
+              other, unit_traits::select_on_container_copy_construction(
+                         other.alloc_)) {}
+
+    OrderedLinkedList(const OrderedLinkedList& other, const Allocator& alloc)
+            : OrderedLinkedList(other.comp_, alloc) {
+        try {
+            copy_from(other);
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+    OrderedLinkedList& operator=(const OrderedLinkedList& other) {
+        if (this == &other) return *this;
+
+        clear();
+        if constexpr (
+                unit_traits::propagate_on_container_copy_assignment::value) {
+            alloc_ = other.alloc_;
+        }
+        comp_ = other.comp_;
+        copy_from(other);
+        return *this;
+    }
+
+    OrderedLinkedList(OrderedLinkedList&& other) noexcept
+            : comp_{other.comp_}, alloc_{std::move(other.alloc_)} {
+        steal_from(other);
+    }
+
+    OrderedLinkedList(OrderedLinkedList&& other, const Allocator& alloc)
+            : OrderedLinkedList(other.comp_, alloc) {
+        if (alloc_ == other.alloc_) {
+            steal_from(other);
+        } else {
+            move_elements_from(other);
+        }
+    }
+
+    OrderedLinkedList& operator=(OrderedLinkedList&& other) noexcept(
+            unit_traits::propagate_on_container_move_assignment::value ||
+            unit_traits::is_always_equal::value) {
+        if (this == &other) return *this;
+
+        clear();
+        comp_ = other.comp_;
+        if constexpr (
+                unit_traits::propagate_on_container_move_assignment::value) {
+            alloc_ = std::move(other.alloc_);
+            steal_from(other);
+        } else if (alloc_ == other.alloc_) {
+            steal_from(other);
+        } else {
+            move_elements_from(other);
+        }
+        return *this;
+    }
+
+    ~OrderedLinkedList() { clear(); }
+
+    [[nodiscard]]
+    allocator_type get_allocator() const { return allocator_type(alloc_); }
+
+    [[nodiscard]]
+    value_compare value_comp() const { return comp_; }
+
+    void clear() {
+        for (auto current{head_[0]}; current;) {
+            const auto next = current->links()[0];
+            destroy_node(current);
+            current = next;
+        }
+        head_   = {};
+        tail_   = nullptr;
+        size_   = 0;
+        levels_ = 1;
+    }
+
+    // As for the standard containers, swapping lists whose allocators
+    // neither propagate nor compare equal is undefined behaviour.
+    friend void swap(OrderedLinkedList& l1, OrderedLinkedList& l2) noexcept {
+        using std::swap;
+        if constexpr (unit_traits::propagate_on_container_swap::value) {
+            swap(l1.alloc_, l2.alloc_);
+        }
+        swap(l1.comp_, l2.comp_);
+        swap(l1.head_, l2.head_);
+        swap(l1.tail_, l2.tail_);
+        swap(l1.size_, l2.size_);
+        swap(l1.levels_, l2.levels_);
+    }
+
+    [[nodiscard]]
+    std::size_t size() const { return size_; };
+
+    [[nodiscard]]
+    auto is_empty() const { return size_ == 0; }
+
+    [[nodiscard]]
+    auto begin() const { return const_iterator{head_[0]}; }
+
+    [[nodiscard]]
+    auto end() const { return const_iterator{nullptr}; }
+
+    [[nodiscard]]
+    auto cbegin() const { return begin(); }
+
+    [[nodiscard]]
+    auto cend() const { return end(); }
+
+    [[nodiscard]]
+    std::expected<std::reference_wrapper<const value_type>, LinkedListError>
+    front() const {
+        if (is_empty()) return std::unexpected(LinkedListError::EmptyList);
+        return head_[0]->data;
+    }
+
+    [[nodiscard]]
+    std::expected<std::reference_wrapper<const value_type>, LinkedListError>
+    back() const {
+        if (is_empty()) return std::unexpected(LinkedListError::EmptyList);
+        return tail_->data;
+    }
+
+    // First element not ordered before `value`, or end().
+    [[nodiscard]]
+    const_iterator lower_bound(const T& value) const {
+        links update;
+        find_links<false>(value, update);
+        return const_iterator{*update[0]};
+    }
+
+    [[nodiscard]]
+    bool contains(const T& value) const {
+        const auto it = lower_bound(value);
+        return it != end() && !comp_(value, *it);
+    }
+
+    // The elements in [low, high).
+    [[nodiscard]]
+    std::ranges::subrange<const_iterator> range(const T& low,
+                                                const T& high) const {
+        const auto first = lower_bound(low);
+        if (!comp_(low, high)) return {first, first};
+        return {first, lower_bound(high)};
+    }
+
+    // Inserts after the elements equivalent to the new one.
+    template <typename... Args>
+    const_iterator emplace(Args&&... args) {
+        const auto height   = random_height();
+        const auto new_node = create_node(height, std::forward<Args>(args)...);
+
+        links update;
+        find_links<true>(new_node->data, update);
+        for (auto level{levels_}; level < height; ++level) {
+            update[level] = &head_links()[level];
+        }
+        levels_ = std::max(levels_, height);
+
+        for (std::size_t level{}; level < height; ++level) {
+            new_node->links()[level] = *update[level];
+            *update[level] = new_node;
+        }
+        if (!new_node->links()[0]) tail_ = new_node;
+        ++size_;
+        return const_iterator{new_node};
+    }
+
+    const_iterator insert(value_type value) {
+        return emplace(std::move(value));
+    }
+
+    // Erases the element at `pos` and returns the position after it.
+    const_iterator erase(const_iterator pos) {
+        const auto target = pos.current_;
+        const auto next   = target->links()[0];
+
+        links update;
+        find_links<false>(target->data, update);
+        // Skip the equivalent elements in front of `target` on each of its
+        // levels.
+        for (std::size_t level{}; level < target->height; ++level) {
+            while (*update[level] != target) {
+                update[level] = &(*update[level])->links()[level];
+            }
+        }
+        unlink(target, update);
+        return const_iterator{next};
+    }
+
+    // Erases every element equivalent to `value` and returns their number.
+    std::size_t erase(const T& value) {
+        links update;
+        find_links<false>(value, update);
+
+        std::size_t erased{};
+        // The first equivalent element is always the one every link in
+        // `update` leads to.
+        for (auto current{*update[0]}; current && !comp_(value, current->data);
+                current = *update[0]) {
+            unlink(current, update);
+            ++erased;
+        }
+        return erased;
+    }
+
+    void pop_front() {
+        if (is_empty()) return;
+
+        links update;
+        for (std::size_t level{}; level < MaxLevel; ++level) {
+            update[level] = &head_links()[level];
+        }
+        unlink(head_[0], update);
+    }
+
+    friend bool operator==(const OrderedLinkedList& lhs,
+                           const OrderedLinkedList& rhs) {
+        if (lhs.size() != rhs.size()) return false;
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    friend std::ostream& operator<<(std::ostream& os,
+                                    const OrderedLinkedList& ll) {
+        os << "[";
+        std::for_each(std::begin(ll), std::end(ll), [&os](const auto& element) {
+            os << element << " -> "; });
+        os << "NULL]";
+        return os;
+    };
+};
+
+template <typename T, typename Compare, std::size_t MaxLevel,
+          typename Allocator>
+struct std::formatter<OrderedLinkedList<T, Compare, MaxLevel, Allocator>>
+    : LinkedListFormatter<T> {};
+
+namespace pmr {
+template <typename T, typename Compare = std::less<>,
+          std::size_t MaxLevel = 16>
+using OrderedLinkedList = ::OrderedLinkedList<
+    T, Compare, MaxLevel, std::pmr::polymorphic_allocator<T>>;
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "LinkedList/WorkStealingPool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+// Parallel algorithms over LinkedList and the other sized list containers.
+//
+// A list cannot be indexed, so it is cut into consecutive parts up front:
+// one walk over the nodes, which only follows links, records where each
+// part starts. The parts are then run as jobs on a WorkStealingPool. There
+// are several parts per thread, so threads that finish early steal parts
+// from the others and uneven per-element costs even out.
+//
+// Worth it when the work per element dominates the walk; for cheap
+// operations the plain loop is faster.
+
+inline constexpr std::size_t parallel_parts_per_thread{4};
+
+namespace detail {
+
+// Returns parts + 1 iterators cutting the `size` elements of `list` into
+// `parts` non-empty consecutive ranges whose lengths differ by at most one.
+template <typename List>
+auto split_points(List& list, std::size_t parts) {
+    using iterator = std::ranges::iterator_t<List>;
+
+    const auto size  = static_cast<std::size_t>(std::ranges::size(list));
+    const auto base  = size / parts;
+    const auto extra = size % parts;
+
+    std::vector<iterator> points;
+    points.reserve(parts + 1);
+
+    auto current = std::ranges::begin(list);
+    points.push_back(current);
+    for (std::size_t part{}; part < parts; ++part) {
+        const auto length = base + (part < extra ? 1 : 0);
+        std::ranges::advance(
+            current, static_cast<std::iter_difference_t<iterator>>(length));
+        points.push_back(current);
+    }
+    return points;
+}
+
+template <typename List>
+std::size_t part_count(const List& list, const WorkStealingPool& pool) {
+    const auto size = static_cast<std::size_t>(std::ranges::size(list));
+    return std::min(size, pool.thread_count() * parallel_parts_per_thread);
+}
+
+}
+
+// Calls f(element) for every element of `list`, concurrently and in no
+// particular order. The list must not be modified structurally meanwhile.
+template <std::ranges::forward_range List, typename F>
+    requires std::ranges::sized_range<List> &&
+             std::invocable<F&, std::ranges::range_reference_t<List>>
+void parallel_for_each(List& list, F f,
+                       WorkStealingPool& pool = WorkStealingPool::shared()) {
+    const auto parts = detail::part_count(list, pool);
+    if (parts == 0) return;
+
+    const auto points = detail::split_points(list, parts);
+    pool.run(parts, [&points, &f](std::size_t part) {
+        std::for_each(points[part], points[part + 1], std::ref(f));
+    });
+}
+
+// Replaces every element with op(element), in parallel.
+template <std::ranges::forward_range List, typename UnaryOp>
+    requires std::ranges::sized_range<List>
+void parallel_transform_inplace(
+        List& list, UnaryOp op,
+        WorkStealingPool& pool = WorkStealingPool::shared()) {
+    parallel_for_each(list, [&op](auto& element) {
+        element = op(std::as_const(element));
+    }, pool);
+}
+
+// Folds the elements with `op` into `init`. Each part is folded on its own
+// and the partial results are combined in list order, so `op` has to be
+// associative but need not be commutative.
+template <std::ranges::forward_range List, typename U, typename BinaryOp>
+    requires std::ranges::sized_range<List>
+U parallel_reduce(const List& list, U init, BinaryOp op,
+                  WorkStealingPool& pool = WorkStealingPool::shared()) {
+    const auto parts = detail::part_count(list, pool);
+    if (parts == 0) return init;
+
+    const auto points = detail::split_points(list, parts);
+    std::vector<std::optional<U>> partials(parts);
+    pool.run(parts, [&points, &partials, &op](std::size_t part) {
+        auto current = points[part];
+        U partial(*current);
+        for (++current; current != points[part + 1]; ++current) {
+            partial = op(std::move(partial), *current);
+        }
+        partials[part].emplace(std::move(partial));
+    });
+
+    for (auto& partial : partials) {
+        init = op(std::move(init), std::move(*partial));
+    }
+    return init;
+}
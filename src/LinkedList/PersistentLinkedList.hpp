@@ -0,0 +1,623 @@
+#pragma once
+
+#include "LinkedList/LinkedList.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <format>
+#include <ostream>
+#include <expected>
+#include <filesystem>
+#include <functional>
+#include <iterator>
+#include <system_error>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Links of a PersistentLinkedList are byte offsets from the start of the
+// file, so they stay valid wherever the file gets mapped. Offset 0 is the
+// file header and serves as the null link.
+//
+// `free_next` chains the node into the free list once it has been freed.
+// Keeping it apart from `next` means that freeing or reusing a node never
+// touches a field that the last committed state still reads.
+template <typename T>
+struct PersistentNode {
+    std::uint64_t next;
+    std::uint64_t free_next;
+    T             data;
+};
+
+// The state of a PersistentLinkedList as of one commit. `redo_node` and
+// `redo_next` record a link that has to be set to `redo_next` once the
+// state is committed, when an operation has to change a link that the
+// previous state reads; opening the file sets it again in case the writer
+// died in between.
+struct PersistentListState {
+    std::uint64_t sequence;
+    std::uint64_t root;
+    std::uint64_t tail;
+    std::uint64_t size;
+    std::uint64_t free_head;
+    std::uint64_t top;
+    std::uint64_t redo_node;
+    std::uint64_t redo_next;
+    std::uint64_t checksum;
+
+    [[nodiscard]]
+    std::uint64_t compute_checksum() const {
+        // FNV-1a over every field but the checksum.
+        std::uint64_t hash{0xcbf29ce484222325};
+        for (const auto field : {sequence, root, tail, size, free_head, top,
+                                 redo_node, redo_next}) {
+            hash = (hash ^ field) * 0x100000001b3;
+        }
+        return hash;
+    }
+};
+
+struct PersistentListHeader {
+    std::array<char, 8> magic;
+    std::uint32_t       version;
+    std::uint32_t       element_size;
+    std::uint32_t       element_align;
+    std::uint32_t       node_size;
+    std::uint64_t       data_start;
+    PersistentListState slots[2];
+};
+
+enum class PersistentListError {
+    SystemError,
+    InvalidFile,
+    UnsupportedVersion,
+    IncompatibleElement,
+};
+
+enum class PersistentMode {
+    ReadWrite,
+    // Maps the file copy-on-write: nothing is ever written back, and the
+    // mutating operations throw.
+    ReadOnly,
+};
+
+template <typename T>
+class PersistentLinkedListIterator {
+    using node         = std::conditional_t<
+                                std::is_const_v<T>,
+                                const PersistentNode<std::remove_const_t<T>>,
+                                PersistentNode<T>>;
+    using byte_pointer = std::conditional_t<std::is_const_v<T>,
+                                            const std::byte*, std::byte*>;
+
+    byte_pointer  base_;
+    std::uint64_t current_;
+
+    template <typename>
+    friend class PersistentLinkedList;
+
+    template <typename>
+    friend class PersistentLinkedListIterator;
+
+    [[nodiscard]]
+    node* current_node() const {
+        return reinterpret_cast<node*>(base_ + current_);
+    }
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = std::remove_const_t<T>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = T*;
+    using reference         = T&;
+
+    PersistentLinkedListIterator() : base_{nullptr}, current_{0} {}
+
+    PersistentLinkedListIterator(byte_pointer base, std::uint64_t current)
+        : base_(base), current_(current) {}
+
+    // iterator -> const_iterator
+    template <typename U>
+        requires (std::is_const_v<T> && std::is_same_v<const U, T>)
+    PersistentLinkedListIterator(const PersistentLinkedListIterator<U>& other)
+        : base_(other.base_), current_(other.current_) {}
+
+    T& operator*()  const { return  current_node()->data; };
+    T* operator->() const { return &current_node()->data; };
+
+    PersistentLinkedListIterator& operator++() {
+        current_ = current_node()->next;
+        return *this;
+    }
+
+    PersistentLinkedListIterator operator++(int) {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    friend bool operator==(const PersistentLinkedListIterator& lhs,
+                           const PersistentLinkedListIterator& rhs) {
+        return lhs.current_ == rhs.current_;
+    }
+};
+
+// Singly linked list of trivially copyable elements whose nodes live in a
+// memory-mapped file, so that the list outlives the process and can be
+// opened again, or by other processes, without a deserialization step.
+// Opening maps the file and reads its header: O(1) whatever the size.
+//
+// Nodes are carved from the file by a bump allocator; freed nodes go to a
+// free list and are reused first. When the file is full it is doubled and
+// mapped again, which invalidates iterators and references.
+//
+// Crash consistency: the header keeps two state slots, each with a
+// sequence number and a checksum. An operation writes its new nodes, which
+// the committed state does not reach, then the new state into the older
+// slot; opening picks the valid slot with the higher sequence number. A
+// writer that dies at any point leaves either the old or the new list.
+// This holds against process crashes; against power loss only after
+// sync(), which flushes the mapping to the disk.
+//
+// One process may open the file for writing at a time, and readers must
+// not run while it writes.
+//
+// Mutating operations throw std::system_error when the file cannot grow,
+// and when the list was opened with PersistentMode::ReadOnly.
+template <typename T>
+class PersistentLinkedList {
+    static_assert(std::is_trivially_copyable_v<T>,
+        "PersistentLinkedList stores only trivially copyable types");
+
+    using node   = PersistentNode<T>;
+    using header = PersistentListHeader;
+
+    static constexpr std::array<char, 8> magic{
+        'L', 'L', 'P', 'E', 'R', 'S', 'I', 'S'};
+    static constexpr std::uint32_t version{1};
+    static constexpr std::uint64_t data_start{
+        (sizeof(header) + alignof(node) - 1) / alignof(node) * alignof(node)};
+    static constexpr std::uint64_t min_file_size{64 * 1024};
+
+    int                 fd_{-1};
+    std::byte*          base_{};
+    std::uint64_t       capacity_{};
+    bool                writable_{};
+    unsigned            active_{};
+    PersistentListState state_{};
+
+    [[nodiscard]]
+    header* file_header() const { return reinterpret_cast<header*>(base_); }
+
+    [[nodiscard]]
+    node* node_at(std::uint64_t offset) const {
+        return reinterpret_cast<node*>(base_ + offset);
+    }
+
+    [[noreturn]]
+    static void throw_errno(const char* what) {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    void unmap() {
+        if (base_) ::munmap(base_, capacity_);
+        if (fd_ >= 0) ::close(fd_);
+        base_ = nullptr;
+        fd_   = -1;
+    }
+
+    [[nodiscard]]
+    static std::expected<std::byte*, PersistentListError>
+    map(int fd, std::uint64_t size, bool writable) {
+        const auto address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                                    writable ? MAP_SHARED : MAP_PRIVATE, fd,
+                                    0);
+        if (address == MAP_FAILED) {
+            return std::unexpected(PersistentListError::SystemError);
+        }
+        return static_cast<std::byte*>(address);
+    }
+
+    void check_writable() const {
+        if (!writable_) {
+            throw std::system_error(
+                std::make_error_code(std::errc::read_only_file_system),
+                "PersistentLinkedList opened read-only");
+        }
+    }
+
+    void grow(std::uint64_t needed) {
+        auto capacity = capacity_;
+        while (capacity < needed) capacity *= 2;
+
+        if (::ftruncate(fd_, static_cast<off_t>(capacity)) != 0) {
+            throw_errno("ftruncate");
+        }
+        const auto remapped = map(fd_, capacity, writable_);
+        if (!remapped) throw_errno("mmap");
+        ::munmap(base_, capacity_);
+        base_     = *remapped;
+        capacity_ = capacity;
+    }
+
+    // Takes a node from the free list or the end of the used space and
+    // records that in `next`. The node is not reachable from the committed
+    // state, so it can be written right away.
+    std::uint64_t allocate(PersistentListState& next) {
+        if (next.free_head) {
+            const auto offset = next.free_head;
+            next.free_head = node_at(offset)->free_next;
+            return offset;
+        }
+        if (next.top + sizeof(node) > capacity_) grow(next.top + sizeof(node));
+        const auto offset = next.top;
+        next.top += sizeof(node);
+        return offset;
+    }
+
+    // Puts the node at `offset` on the free list of `next`. The committed
+    // state may still reach the node, which is why only `free_next` is
+    // written.
+    void release(PersistentListState& next, std::uint64_t offset) {
+        node_at(offset)->free_next = next.free_head;
+        next.free_head = offset;
+    }
+
+    // Writes `next` into the slot not holding the committed state, then
+    // sets its redo link.
+    void commit(PersistentListState next) {
+        next.sequence = state_.sequence + 1;
+        const auto slot = active_ ^ 1u;
+        auto& target = file_header()->slots[slot];
+
+        // Nodes first, then the state; the checksum, stored last, makes
+        // the slot valid.
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(&target, &next, offsetof(PersistentListState, checksum));
+        std::atomic_ref<std::uint64_t>{target.checksum}.store(
+            next.compute_checksum(), std::memory_order_release);
+
+        active_ = slot;
+        state_  = next;
+        if (next.redo_node) node_at(next.redo_node)->next = next.redo_next;
+    }
+
+    [[nodiscard]]
+    PersistentListState next_state() const {
+        auto next = state_;
+        next.redo_node = next.redo_next = 0;
+        return next;
+    }
+
+    PersistentLinkedList(int fd, std::byte* base, std::uint64_t capacity,
+                         bool writable)
+        : fd_{fd}, base_{base}, capacity_{capacity}, writable_{writable} {}
+
+    friend struct std::formatter<PersistentLinkedList>;
+
+public:
+    using value_type      = T;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+
+    using iterator        = PersistentLinkedListIterator<T>;
+    using const_iterator  = PersistentLinkedListIterator<const T>;
+
+    // Creates an empty list in `path`, replacing any file there.
+    [[nodiscard]]
+    static std::expected<PersistentLinkedList, PersistentListError>
+    create(const std::filesystem::path& path) {
+        const auto fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) return std::unexpected(PersistentListError::SystemError);
+        if (::ftruncate(fd, static_cast<off_t>(min_file_size)) != 0) {
+            ::close(fd);
+            return std::unexpected(PersistentListError::SystemError);
+        }
+        const auto base = map(fd, min_file_size, true);
+        if (!base) {
+            ::close(fd);
+            return std::unexpected(base.error());
+        }
+
+        PersistentLinkedList result{fd, *base, min_file_size, true};
+        auto& file = *result.file_header();
+        file.magic         = magic;
+        file.version       = version;
+        file.element_size  = sizeof(T);
+        file.element_align = alignof(T);
+        file.node_size     = sizeof(node);
+        file.data_start    = data_start;
+
+        result.state_.top = data_start;
+        result.active_    = 1;
+        result.commit(result.next_state());
+        return result;
+    }
+
+    // Opens a list created by create(). With PersistentMode::ReadWrite a
+    // link left unset by a writer that died is repaired first.
+    [[nodiscard]]
+    static std::expected<PersistentLinkedList, PersistentListError>
+    open(const std::filesystem::path& path,
+         PersistentMode mode = PersistentMode::ReadWrite) {
+        const bool writable = mode == PersistentMode::ReadWrite;
+        const auto fd = ::open(path.c_str(), writable ? O_RDWR : O_RDONLY);
+        if (fd < 0) return std::unexpected(PersistentListError::SystemError);
+
+        struct stat info{};
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            return std::unexpected(PersistentListError::SystemError);
+        }
+        const auto size = static_cast<std::uint64_t>(info.st_size);
+        if (size < data_start) {
+            ::close(fd);
+            return std::unexpected(PersistentListError::InvalidFile);
+        }
+        const auto base = map(fd, size, writable);
+        if (!base) {
+            ::close(fd);
+            return std::unexpected(base.error());
+        }
+
+        PersistentLinkedList result{fd, *base, size, writable};
+        const auto& file = *result.file_header();
+        if (file.magic != magic) {
+            return std::unexpected(PersistentListError::InvalidFile);
+        }
+        if (file.version != version) {
+            return std::unexpected(PersistentListError::UnsupportedVersion);
+        }
+        if (file.element_size  != sizeof(T) ||
+            file.element_align != alignof(T) ||
+            file.node_size     != sizeof(node) ||
+            file.data_start    != data_start) {
+            return std::unexpected(PersistentListError::IncompatibleElement);
+        }
+
+        // The valid slot with the higher sequence number.
+        const auto valid = [&file, size](unsigned slot) {
+            const auto& state = file.slots[slot];
+            return state.checksum == state.compute_checksum() &&
+                   state.top <= size;
+        };
+        if (!valid(0) && !valid(1)) {
+            return std::unexpected(PersistentListError::InvalidFile);
+        }
+        result.active_ =
+            !valid(0) || (valid(1) &&
+                          file.slots[1].sequence > file.slots[0].sequence)
+            ? 1 : 0;
+        result.state_ = file.slots[result.active_];
+
+        // Also done on the private mapping of a read-only list.
+        if (result.state_.redo_node) {
+            result.node_at(result.state_.redo_node)->next =
+                result.state_.redo_next;
+        }
+        return result;
+    }
+
+    PersistentLinkedList(const PersistentLinkedList&)            = delete;
+    PersistentLinkedList& operator=(const PersistentLinkedList&) = delete;
+
+    PersistentLinkedList(PersistentLinkedList&& other) noexcept
+        : fd_{std::exchange(other.fd_, -1)},
+          base_{std::exchange(other.base_, nullptr)},
+          capacity_{std::exchange(other.capacity_, 0)},
+          writable_{other.writable_},
+          active_{other.active_},
+          state_{other.state_} {}
+
+    PersistentLinkedList& operator=(PersistentLinkedList&& other) noexcept {
+        if (this == &other) return *this;
+
+        unmap();
+        fd_       = std::exchange(other.fd_, -1);
+        base_     = std::exchange(other.base_, nullptr);
+        capacity_ = std::exchange(other.capacity_, 0);
+        writable_ = other.writable_;
+        active_   = other.active_;
+        state_    = other.state_;
+        return *this;
+    }
+
+    ~PersistentLinkedList() { unmap(); }
+
+    // Flushes the mapping and the file size to the disk.
+    void sync() {
+        check_writable();
+        if (::msync(base_, capacity_, MS_SYNC) != 0) throw_errno("msync");
+        if (::fsync(fd_) != 0) throw_errno("fsync");
+    }
+
+    [[nodiscard]]
+    std::size_t size() const { return static_cast<std::size_t>(state_.size); }
+
+    [[nodiscard]]
+    auto is_empty() const { return state_.size == 0; }
+
+    // Size of the file, which is also the size of the mapping.
+    [[nodiscard]]
+    std::size_t file_size() const {
+        return static_cast<std::size_t>(capacity_);
+    }
+
+    [[nodiscard]]
+    auto begin() { return iterator{base_, state_.root}; }
+
+    [[nodiscard]]
+    auto end() { return iterator{base_, 0}; }
+
+    [[nodiscard]]
+    auto begin() const { return const_iterator{base_, state_.root}; }
+
+    [[nodiscard]]
+    auto end() const { return const_iterator{base_, 0}; }
+
+    [[nodiscard]]
+    auto cbegin() const { return begin(); }
+
+    [[nodiscard]]
+    auto cend() const { return end(); }
+
+    [[nodiscard]]
+    auto contains(const_reference value) const {
+        return std::find(begin(), end(), value) != end();
+    }
+
+    [[nodiscard]]
+    std::expected<std::reference_wrapper<value_type>, LinkedListError>
+    front() {
+        if (is_empty()) return std::unexpected(LinkedListError::EmptyList);
+        return node_at(state_.root)->data;
+    }
+
+    [[nodiscard]]
+    std::expected<std::reference_wrapper<const value_type>, LinkedListError>
+    front() const {
+        if (is_empty()) return std::unexpected(LinkedListError::EmptyList);
+        return node_at(state_.root)->data;
+    }
+
+    [[nodiscard]]
+    std::expected<std::reference_wrapper<value_type>, LinkedListError>
+    back() {
+        if (is_empty()) return std::unexpected(LinkedListError::EmptyList);
+        return node_at(state_.tail)->data;
+    }
+
+    [[nodiscard]]
+    std::expected<std::reference_wrapper<const value_type>, LinkedListError>
+    back() const {
+        if (is_empty()) return std::unexpected(LinkedListError::EmptyList);
+        return node_at(state_.tail)->data;
+    }
+
+    void push_front(value_type data) {
+        check_writable();
+        auto next = next_state();
+        const auto offset = allocate(next);
+        auto& new_node = *node_at(offset);
+        new_node.next = next.root;
+        new_node.data = data;
+
+        next.root = offset;
+        if (!next.tail) next.tail = offset;
+        ++next.size;
+        commit(next);
+    }
+
+    void push_back(value_type data) {
+        check_writable();
+        auto next = next_state();
+        const auto offset = allocate(next);
+        auto& new_node = *node_at(offset);
+        new_node.next = 0;
+        new_node.data = data;
+
+        // The committed state ends at the old tail, so linking the new node
+        // to it waits for the commit.
+        if (next.tail) {
+            next.redo_node = next.tail;
+            next.redo_next = offset;
+        } else {
+            next.root = offset;
+        }
+        next.tail = offset;
+        ++next.size;
+        commit(next);
+    }
+
+    void pop_front() {
+        check_writable();
+        if (is_empty()) return;
+
+        auto next = next_state();
+        const auto first = next.root;
+        next.root = node_at(first)->next;
+        if (!next.root) next.tail = 0;
+        --next.size;
+        release(next, first);
+        commit(next);
+    }
+
+    // O(n): the node before the last one has to be found by a walk.
+    void pop_back() {
+        check_writable();
+        if (state_.size < 2) {
+            pop_front();
+            return;
+        }
+
+        auto prev = state_.root;
+        while (node_at(prev)->next != state_.tail) prev = node_at(prev)->next;
+
+        auto next = next_state();
+        release(next, next.tail);
+        next.tail      = prev;
+        next.redo_node = prev;
+        next.redo_next = 0;
+        --next.size;
+        commit(next);
+    }
+
+    void clear() {
+        check_writable();
+        auto next = next_state();
+        next.root = next.tail = next.size = next.free_head = 0;
+        next.top  = data_start;
+        commit(next);
+    }
+
+    // Removes the first element equal to `data`.
+    void remove(const_reference data) {
+        check_writable();
+        std::uint64_t prev{};
+        for (auto current{state_.root}; current;
+                prev = current, current = node_at(current)->next) {
+            if (!(node_at(current)->data == data)) continue;
+
+            if (!prev) {
+                pop_front();
+                return;
+            }
+            auto next = next_state();
+            if (current == next.tail) next.tail = prev;
+            next.redo_node = prev;
+            next.redo_next = node_at(current)->next;
+            --next.size;
+            release(next, current);
+            commit(next);
+            return;
+        }
+    }
+
+    friend bool operator==(const PersistentLinkedList& lhs,
+                           const PersistentLinkedList& rhs) {
+        if (lhs.size() != rhs.size()) return false;
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    friend std::ostream& operator<<(std::ostream& os,
+                                    const PersistentLinkedList& ll) {
+        os << "[";
+        std::for_each(std::begin(ll), std::end(ll), [&os](const auto& element) {
+            os << element << " -> "; });
+        os << "NULL]";
+        return os;
+    };
+};
+
+template <typename T>
+struct std::formatter<PersistentLinkedList<T>>
+    : LinkedListFormatter<T> {};
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// Positional index policies for LinkedList.
+//
+// NoIndex keeps nothing: positional access walks from the first node.
+// BlockIndex cuts the list into blocks of about sqrt(n) nodes and keeps the
+// first node and the length of every block, so reaching position i costs a
+// scan over the blocks plus a walk inside one block, O(sqrt(n)) in total.
+//
+// The index follows push/pop at both ends, remove() and the positional
+// operations incrementally. Operations that relink nodes wholesale (sort,
+// merge, splicing, ...) only mark it stale; it is rebuilt in O(n) on the
+// next positional access through a non-const list.
+struct NoIndex {
+    static constexpr bool enabled{false};
+};
+
+struct BlockIndex {
+    static constexpr bool enabled{true};
+};
+
+template <typename Index, typename NodePointer, typename Allocator>
+class PositionIndex {
+public:
+    explicit constexpr PositionIndex(const Allocator&) {}
+
+    [[nodiscard]]
+    constexpr bool valid() const { return false; }
+
+    [[nodiscard]]
+    constexpr std::size_t bytes() const { return 0; }
+
+    constexpr void invalidate() {}
+    constexpr void clear() {}
+    constexpr void rebuild(NodePointer, std::size_t) {}
+
+    [[nodiscard]]
+    constexpr std::pair<NodePointer, std::size_t>
+    seek(std::size_t) const { return {}; }
+
+    constexpr void inserted(std::size_t, NodePointer, NodePointer,
+                            std::size_t) {}
+    constexpr void erased(std::size_t, NodePointer) {}
+
+    friend constexpr void swap(PositionIndex&, PositionIndex&) noexcept {}
+};
+
+template <typename NodePointer, typename Allocator>
+class PositionIndex<BlockIndex, NodePointer, Allocator> {
+    struct block {
+        NodePointer first;
+        std::size_t count;
+    };
+
+    using block_allocator =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<
+            block>;
+
+    static constexpr std::size_t min_block_size{16};
+
+    std::vector<block, block_allocator> blocks_;
+    std::size_t block_size_{min_block_size};
+    bool        valid_{true};
+
+    // Index of the block holding `position`, which must be below the size
+    // of the list, and the position of its first node.
+    [[nodiscard]]
+    constexpr std::pair<std::size_t, std::size_t>
+    find(std::size_t position) const {
+        std::size_t b{};
+        std::size_t start{};
+        for (; start + blocks_[b].count <= position; ++b) {
+            start += blocks_[b].count;
+        }
+        return {b, start};
+    }
+
+    constexpr void split(std::size_t b) {
+        auto first = blocks_[b].first;
+        for (std::size_t i{}; i < block_size_; ++i) first = first->next;
+
+        const auto rest = blocks_[b].count - block_size_;
+        blocks_[b].count = block_size_;
+        blocks_.insert(blocks_.begin() + static_cast<std::ptrdiff_t>(b + 1),
+                       block{first, rest});
+    }
+
+    // Merges the block `b`, which got small, into a neighbour so that
+    // erasures do not leave many tiny blocks behind.
+    constexpr void merge(std::size_t b) {
+        if (blocks_.size() < 2) return;
+        if (b + 1 == blocks_.size()) --b;
+
+        blocks_[b].count += blocks_[b + 1].count;
+        blocks_.erase(blocks_.begin() + static_cast<std::ptrdiff_t>(b + 1));
+        if (blocks_[b].count > 2 * block_size_) split(b);
+    }
+
+public:
+    explicit constexpr PositionIndex(const Allocator& alloc)
+        : blocks_(block_allocator(alloc)) {}
+
+    [[nodiscard]]
+    constexpr bool valid() const { return valid_; }
+
+    [[nodiscard]]
+    constexpr std::size_t bytes() const {
+        return blocks_.capacity() * sizeof(block);
+    }
+
+    constexpr void invalidate() { valid_ = false; }
+
+    constexpr void clear() {
+        blocks_.clear();
+        block_size_ = min_block_size;
+        valid_      = true;
+    }
+
+    // Leaves the index invalid if it throws.
+    constexpr void rebuild(NodePointer root, std::size_t size) {
+        clear();
+        valid_ = false;
+        while (block_size_ * block_size_ < size) block_size_ *= 2;
+
+        blocks_.reserve(size / block_size_ + 1);
+        for (auto current{root}; current;) {
+            block next{current, 0};
+            for (; current && next.count < block_size_; ++next.count) {
+                current = current->next;
+            }
+            blocks_.push_back(next);
+        }
+        valid_ = true;
+    }
+
+    // The nearest indexed node at or before `position`, which must be below
+    // the size of the list, and how many nodes lie between the two.
+    [[nodiscard]]
+    constexpr std::pair<NodePointer, std::size_t>
+    seek(std::size_t position) const {
+        const auto [b, start] = find(position);
+        return {blocks_[b].first, position - start};
+    }
+
+    // `node` was inserted at `position`; the list now has `size` nodes
+    // starting at `root`.
+    constexpr void inserted(std::size_t position, NodePointer node,
+                            NodePointer root, std::size_t size) {
+        if (!valid_) return;
+        if (size > 4 * block_size_ * block_size_) {
+            rebuild(root, size);
+            return;
+        }
+        if (blocks_.empty()) {
+            blocks_.push_back(block{node, 1});
+            return;
+        }
+
+        // A node joins the block of the node before it; a new first node
+        // starts the first block. Both ends are found without a scan, which
+        // keeps push_front() and push_back() O(1).
+        std::size_t b{};
+        if (position == 0) {
+            blocks_.front().first = node;
+        } else if (position + 1 == size) {
+            b = blocks_.size() - 1;
+        } else {
+            b = find(position - 1).first;
+        }
+        if (++blocks_[b].count > 2 * block_size_) split(b);
+    }
+
+    // The node at `position` was erased; `next` took its place, nullptr
+    // when it was the last node.
+    constexpr void erased(std::size_t position, NodePointer next) {
+        if (!valid_) return;
+
+        auto [b, start] = next ? find(position)
+                               : std::pair{blocks_.size() - 1,
+                                           position + 1 -
+                                               blocks_.back().count};
+        if (position == start) blocks_[b].first = next;
+        if (--blocks_[b].count == 0) {
+            blocks_.erase(blocks_.begin() + static_cast<std::ptrdiff_t>(b));
+        } else if (blocks_[b].count < block_size_ / 2) {
+            merge(b);
+        }
+    }
+
+    friend constexpr void swap(PositionIndex& i1, PositionIndex& i2) noexcept {
+        using std::swap;
+        swap(i1.blocks_, i2.blocks_);
+        swap(i1.block_size_, i2.block_size_);
+        swap(i1.valid_, i2.valid_);
+    }
+};
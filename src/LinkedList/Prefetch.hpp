@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+
+// Software prefetching for walks over node chains.
+//
+// A linked list cannot be prefetched far ahead: the address of a node is
+// only known once its predecessor has been loaded. What can be done is to
+// run a cursor a few nodes in front of the traversal and prefetch each node
+// it reaches, so that fetching the chain overlaps with the work done on the
+// nodes behind the cursor. The more work per node (comparisons, copies,
+// destruction), the more latency this hides.
+
+// Traversal policies for LinkedList.
+struct SequentialTraversal {
+    static constexpr std::size_t distance{0};
+};
+
+template <std::size_t Distance = 4>
+struct PrefetchTraversal {
+    static_assert(Distance > 0, "use SequentialTraversal for no prefetching");
+    static constexpr std::size_t distance{Distance};
+};
+
+constexpr void prefetch(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+    if !consteval {
+        __builtin_prefetch(address);
+    }
+#else
+    (void)address;
+#endif
+}
+
+// The cursor in front of a walk over nodes linked by `next`. Empty and free
+// for SequentialTraversal.
+template <typename Traversal, typename NodePointer>
+class NodeLookahead {
+    NodePointer ahead_{};
+
+public:
+    explicit constexpr NodeLookahead(NodePointer first) {
+        if constexpr (Traversal::distance > 0) {
+            ahead_ = first;
+            for (std::size_t i{}; i < Traversal::distance && ahead_; ++i) {
+                ahead_ = ahead_->next;
+                if (ahead_) prefetch(ahead_);
+            }
+        }
+    }
+
+    // Called once per node the walk moves past.
+    constexpr void advance() {
+        if constexpr (Traversal::distance > 0) {
+            if (!ahead_) return;
+            ahead_ = ahead_->next;
+            if (ahead_) prefetch(ahead_);
+        }
+    }
+};
+
+// Forward iterator adaptor that prefetches the element `Distance` positions
+// ahead of the one it points to. Meant for iterators into node based
+// containers, where an element lives next to the link to its successor.
+template <std::forward_iterator Iterator, std::size_t Distance = 4>
+class PrefetchingIterator {
+    Iterator current_{};
+    Iterator ahead_{};
+    Iterator end_{};
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = std::iter_value_t<Iterator>;
+    using difference_type   = std::iter_difference_t<Iterator>;
+    using reference         = std::iter_reference_t<Iterator>;
+
+    constexpr PrefetchingIterator() = default;
+
+    constexpr PrefetchingIterator(Iterator current, Iterator end)
+        : current_{current}, ahead_{current}, end_{end} {
+        for (std::size_t i{}; i < Distance && ahead_ != end_; ++i) {
+            ++ahead_;
+            if (ahead_ != end_) prefetch(std::addressof(*ahead_));
+        }
+    }
+
+    constexpr reference operator*() const { return *current_; }
+
+    constexpr PrefetchingIterator& operator++() {
+        ++current_;
+        if (ahead_ != end_) {
+            ++ahead_;
+            if (ahead_ != end_) prefetch(std::addressof(*ahead_));
+        }
+        return *this;
+    }
+
+    constexpr PrefetchingIterator operator++(int) {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    [[nodiscard]]
+    constexpr Iterator base() const { return current_; }
+
+    friend constexpr bool operator==(const PrefetchingIterator& lhs,
+                                     const PrefetchingIterator& rhs) {
+        return lhs.current_ == rhs.current_;
+    }
+};
+
+// Views `range` through PrefetchingIterator:
+//     for (auto& element : prefetched(ll)) ...
+template <std::size_t Distance = 4, std::ranges::forward_range R>
+    requires std::ranges::common_range<R>
+constexpr auto prefetched(R& range) {
+    using iterator = PrefetchingIterator<std::ranges::iterator_t<R>, Distance>;
+    return std::ranges::subrange{
+        iterator{std::ranges::begin(range), std::ranges::end(range)},
+        iterator{std::ranges::end(range), std::ranges::end(range)}};
+}
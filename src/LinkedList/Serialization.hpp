@@ -0,0 +1,384 @@
+#pragma once
+
+#include "LinkedList/LinkedList.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <spanstream>
+#include <streambuf>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Binary serialization of LinkedList.
+//
+// The format is a 24-byte header followed by the elements:
+//
+//     offset  size  field
+//          0     4  magic "LLST"
+//          4     2  format version (1)
+//          6     1  byte order of the writer: 1 little, 2 big endian
+//          7     1  encoding: 1 bulk, 2 per element
+//          8     4  sizeof(T) for the bulk encoding, 0 otherwise
+//         12     4  reserved, 0
+//         16     8  element count
+//
+// All header fields are in the writer's byte order. Trivially copyable
+// elements are stored in bulk, as their object representation back to
+// back; data written on a machine with another byte order or another
+// sizeof(T) is rejected. Other element types are written one by one by
+// ElementSerializer<T>, which is provided for std::basic_string of
+// trivially copyable characters and can be specialized for other types:
+//
+//     template <>
+//     struct ElementSerializer<Point> {
+//         static void  write(std::ostream& os, const Point& point);
+//         static Point read(std::istream& is);
+//     };
+//
+// A specialization takes precedence over the bulk encoding. read() reports
+// a failure by setting the stream's failbit or by throwing.
+//
+// deserialize() allocates the nodes one by one in list order, as the range
+// constructors do, so the loaded list does not recycle nodes and can be
+// relinked into other lists. Call relinearize() on it to lay its nodes out
+// in one block.
+
+enum class SerializationError {
+    InvalidHeader,
+    UnsupportedVersion,
+    IncompatibleFormat,
+    Truncated,
+    BufferTooSmall,
+    StreamError,
+};
+
+template <typename T>
+struct ElementSerializer;
+
+template <typename CharT, typename Traits, typename Allocator>
+    requires std::is_trivially_copyable_v<CharT>
+struct ElementSerializer<std::basic_string<CharT, Traits, Allocator>> {
+    using string = std::basic_string<CharT, Traits, Allocator>;
+
+    static void write(std::ostream& os, const string& value) {
+        const auto length = static_cast<std::uint64_t>(value.size());
+        os.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        os.write(reinterpret_cast<const char*>(value.data()),
+                 static_cast<std::streamsize>(value.size() * sizeof(CharT)));
+    }
+
+    static string read(std::istream& is) {
+        std::uint64_t length{};
+        is.read(reinterpret_cast<char*>(&length), sizeof(length));
+        string value;
+        // Grown as the characters arrive, so that a corrupt length cannot
+        // make it allocate far more than the input holds.
+        constexpr std::uint64_t step{4096};
+        for (std::uint64_t done{}; is && done < length;) {
+            const auto count = std::min(step, length - done);
+            value.resize(static_cast<std::size_t>(done + count));
+            is.read(reinterpret_cast<char*>(value.data() + done),
+                    static_cast<std::streamsize>(count * sizeof(CharT)));
+            done += count;
+        }
+        return value;
+    }
+};
+
+// Whether T is written by an ElementSerializer rather than in bulk.
+template <typename T>
+concept element_serialized = requires(std::ostream& os, std::istream& is,
+                                      const T& value) {
+    ElementSerializer<T>::write(os, value);
+    { ElementSerializer<T>::read(is) } -> std::same_as<T>;
+};
+
+template <typename T>
+concept serializable =
+    element_serialized<T> || std::is_trivially_copyable_v<T>;
+
+namespace detail {
+
+struct SerializationHeader {
+    std::array<char, 4> magic;
+    std::uint16_t       version;
+    std::uint8_t        byte_order;
+    std::uint8_t        encoding;
+    std::uint32_t       element_size;
+    std::uint32_t       reserved;
+    std::uint64_t       count;
+};
+
+static_assert(sizeof(SerializationHeader) == 24);
+static_assert(std::is_trivially_copyable_v<SerializationHeader>);
+
+inline constexpr std::array<char, 4> serialization_magic{'L', 'L', 'S', 'T'};
+inline constexpr std::uint16_t       serialization_version{1};
+inline constexpr std::uint8_t        bulk_encoding{1};
+inline constexpr std::uint8_t        element_encoding{2};
+
+inline constexpr std::uint8_t native_byte_order{
+    std::endian::native == std::endian::little ? 1 : 2};
+
+// Elements staged per write() or read() call of the bulk encoding.
+inline constexpr std::size_t bulk_chunk_bytes{64 * 1024};
+
+template <typename T>
+constexpr SerializationHeader make_header(std::size_t count) {
+    const bool bulk = !element_serialized<T>;
+    return {serialization_magic, serialization_version, native_byte_order,
+            bulk ? bulk_encoding : element_encoding,
+            bulk ? static_cast<std::uint32_t>(sizeof(T)) : 0, 0,
+            static_cast<std::uint64_t>(count)};
+}
+
+template <typename T>
+std::expected<std::uint64_t, SerializationError>
+check_header(const SerializationHeader& header) {
+    if (header.magic != serialization_magic) {
+        return std::unexpected(SerializationError::InvalidHeader);
+    }
+    if (header.version != serialization_version) {
+        return std::unexpected(SerializationError::UnsupportedVersion);
+    }
+    const auto expected = make_header<T>(0);
+    if (header.byte_order   != expected.byte_order ||
+        header.encoding     != expected.encoding ||
+        header.element_size != expected.element_size) {
+        return std::unexpected(SerializationError::IncompatibleFormat);
+    }
+    return header.count;
+}
+
+template <typename T>
+T load_element(const std::byte* bytes) {
+    std::array<std::byte, sizeof(T)> raw;
+    std::memcpy(raw.data(), bytes, sizeof(T));
+    return std::bit_cast<T>(raw);
+}
+
+// Number of characters left in `is`, if the stream can seek.
+inline std::optional<std::uint64_t> remaining_size(std::istream& is) {
+    const auto here = is.tellg();
+    if (here == std::istream::pos_type(-1)) return std::nullopt;
+
+    is.seekg(0, std::ios::end);
+    const auto end = is.tellg();
+    is.clear();
+    is.seekg(here);
+    if (end == std::istream::pos_type(-1) || !is) {
+        is.clear();
+        return std::nullopt;
+    }
+    return static_cast<std::uint64_t>(end - here);
+}
+
+// Counts the characters written to it and drops them.
+class CountingBuffer : public std::streambuf {
+    std::size_t count_{};
+
+protected:
+    int_type overflow(int_type ch) override {
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) ++count_;
+        return traits_type::not_eof(ch);
+    }
+
+    std::streamsize xsputn(const char*, std::streamsize count) override {
+        count_ += static_cast<std::size_t>(count);
+        return count;
+    }
+
+public:
+    [[nodiscard]]
+    std::size_t count() const { return count_; }
+};
+
+}
+
+// Writes `ll` to `os` in the format described above.
+template <typename T, typename... Policies>
+    requires serializable<T>
+std::expected<void, SerializationError>
+serialize(const LinkedList<T, Policies...>& ll, std::ostream& os) {
+    const auto header = detail::make_header<T>(ll.size());
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    if constexpr (element_serialized<T>) {
+        for (const auto& element : ll) {
+            if (!os) break;
+            ElementSerializer<T>::write(os, element);
+        }
+    } else {
+        // Nodes are scattered, so the elements are gathered into a buffer
+        // and written a chunk at a time.
+        constexpr auto chunk =
+            std::max<std::size_t>(detail::bulk_chunk_bytes / sizeof(T), 1);
+        std::vector<std::byte> buffer(chunk * sizeof(T));
+        std::size_t staged{};
+        const auto flush = [&] {
+            os.write(reinterpret_cast<const char*>(buffer.data()),
+                     static_cast<std::streamsize>(staged * sizeof(T)));
+            staged = 0;
+        };
+        for (const auto& element : ll) {
+            std::memcpy(buffer.data() + staged * sizeof(T),
+                        std::addressof(element), sizeof(T));
+            if (++staged == chunk) flush();
+        }
+        flush();
+    }
+
+    if (!os) return std::unexpected(SerializationError::StreamError);
+    return {};
+}
+
+// Number of bytes serialize() writes for `ll`. O(1) for the bulk encoding;
+// the per-element one serializes into a counter.
+template <typename T, typename... Policies>
+    requires serializable<T>
+std::size_t serialized_size(const LinkedList<T, Policies...>& ll) {
+    if constexpr (element_serialized<T>) {
+        detail::CountingBuffer counter;
+        std::ostream os{&counter};
+        for (const auto& element : ll) {
+            ElementSerializer<T>::write(os, element);
+        }
+        return sizeof(detail::SerializationHeader) + counter.count();
+    } else {
+        return sizeof(detail::SerializationHeader) + ll.size() * sizeof(T);
+    }
+}
+
+// Writes `ll` to the start of `buffer` and returns the number of bytes
+// written; see serialized_size().
+template <typename T, typename... Policies>
+    requires serializable<T>
+std::expected<std::size_t, SerializationError>
+serialize(const LinkedList<T, Policies...>& ll, std::span<std::byte> buffer) {
+    if constexpr (element_serialized<T>) {
+        std::ospanstream os{std::span<char>{
+            reinterpret_cast<char*>(buffer.data()), buffer.size()}};
+        if (!serialize(ll, os)) {
+            return std::unexpected(SerializationError::BufferTooSmall);
+        }
+        return static_cast<std::size_t>(os.span().size());
+    } else {
+        const auto size = serialized_size(ll);
+        if (size > buffer.size()) {
+            return std::unexpected(SerializationError::BufferTooSmall);
+        }
+
+        const auto header = detail::make_header<T>(ll.size());
+        std::memcpy(buffer.data(), &header, sizeof(header));
+        auto out = buffer.data() + sizeof(header);
+        for (const auto& element : ll) {
+            std::memcpy(out, std::addressof(element), sizeof(T));
+            out += sizeof(T);
+        }
+        return size;
+    }
+}
+
+// Reads a list written by serialize() from `is`.
+template <typename List>
+    requires serializable<typename List::value_type>
+std::expected<List, SerializationError>
+deserialize(std::istream& is,
+            const typename List::allocator_type& alloc = {}) {
+    using T = typename List::value_type;
+
+    detail::SerializationHeader header;
+    if (!is.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        return std::unexpected(SerializationError::Truncated);
+    }
+    const auto count = detail::check_header<T>(header);
+    if (!count) return std::unexpected(count.error());
+
+    // The count comes from the input: nodes are only allocated as the
+    // elements arrive, so that a corrupt count cannot make it allocate far
+    // more than the input holds.
+    List result(alloc);
+    if (*count == 0) return result;
+
+    if constexpr (element_serialized<T>) {
+        for (std::uint64_t i{}; i < *count; ++i) {
+            auto element = ElementSerializer<T>::read(is);
+            if (!is) return std::unexpected(SerializationError::Truncated);
+            result.push_back(std::move(element));
+        }
+    } else {
+        // A count the stream cannot hold fails before reading anything.
+        if (const auto remaining = detail::remaining_size(is)) {
+            if (*count > *remaining / sizeof(T)) {
+                return std::unexpected(SerializationError::Truncated);
+            }
+        }
+        constexpr auto chunk =
+            std::max<std::size_t>(detail::bulk_chunk_bytes / sizeof(T), 1);
+        std::vector<std::byte> buffer(chunk * sizeof(T));
+        for (std::uint64_t done{}; done < *count;) {
+            const auto staged = static_cast<std::size_t>(
+                std::min<std::uint64_t>(chunk, *count - done));
+            if (!is.read(reinterpret_cast<char*>(buffer.data()),
+                         static_cast<std::streamsize>(staged * sizeof(T)))) {
+                return std::unexpected(SerializationError::Truncated);
+            }
+            result.append_range(
+                std::views::iota(std::size_t{}, staged) |
+                std::views::transform([&buffer](std::size_t i) {
+                    return detail::load_element<T>(
+                        buffer.data() + i * sizeof(T));
+                }));
+            done += staged;
+        }
+    }
+    return result;
+}
+
+// Reads a list written by serialize() from `bytes`.
+template <typename List>
+    requires serializable<typename List::value_type>
+std::expected<List, SerializationError>
+deserialize(std::span<const std::byte> bytes,
+            const typename List::allocator_type& alloc = {}) {
+    using T = typename List::value_type;
+
+    if constexpr (element_serialized<T>) {
+        std::ispanstream is{std::span<const char>{
+            reinterpret_cast<const char*>(bytes.data()), bytes.size()}};
+        return deserialize<List>(is, alloc);
+    } else {
+        detail::SerializationHeader header;
+        if (bytes.size() < sizeof(header)) {
+            return std::unexpected(SerializationError::Truncated);
+        }
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        const auto count = detail::check_header<T>(header);
+        if (!count) return std::unexpected(count.error());
+
+        const auto payload = bytes.subspan(sizeof(header));
+        if (*count > payload.size() / sizeof(T)) {
+            return std::unexpected(SerializationError::Truncated);
+        }
+
+        List result(alloc);
+        result.append_range(
+            std::views::iota(std::size_t{}, static_cast<std::size_t>(*count)) |
+            std::views::transform([payload](std::size_t i) {
+                return detail::load_element<T>(
+                    payload.data() + i * sizeof(T));
+            }));
+        return result;
+    }
+}
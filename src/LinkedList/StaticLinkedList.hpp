@@ -0,0 +1,449 @@
+#pragma once
+
+#include "LinkedList/LinkedList.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <format>
+#include <ostream>
+#include <expected>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+// Smallest unsigned type that can index `Capacity` nodes and still has a
+// value left over for the null link.
+template <std::size_t Capacity>
+using static_list_index_t =
+    std::conditional_t<(Capacity < std::numeric_limits<std::uint8_t>::max()),
+        std::uint8_t,
+    std::conditional_t<(Capacity < std::numeric_limits<std::uint16_t>::max()),
+        std::uint16_t,
+        std::uint32_t>>;
+
+template <typename T, typename Index>
+struct StaticNode {
+    // `data` is alive only while the node is in use; a free node holds
+    // `empty` so that the node is always fully initialised, as constant
+    // evaluation requires.
+    union {
+        char empty{};
+        T    data;
+    };
+    Index next{};
+
+    constexpr StaticNode() {}
+
+    constexpr ~StaticNode()
+        requires std::is_trivially_destructible_v<T> = default;
+    constexpr ~StaticNode() {}
+
+    StaticNode(const StaticNode&)            = delete;
+    StaticNode& operator=(const StaticNode&) = delete;
+};
+
+template <typename T, typename Index>
+class StaticLinkedListIterator {
+    using node         = std::conditional_t<
+                                std::is_const_v<T>,
+                                const StaticNode<std::remove_const_t<T>, Index>,
+                                StaticNode<T, Index>>;
+    using node_pointer = node*;
+
+    static constexpr Index npos{std::numeric_limits<Index>::max()};
+
+    node_pointer nodes_;
+    Index        current_;
+
+    template <typename, std::size_t>
+    friend class StaticLinkedList;
+
+    template <typename, typename>
+    friend class StaticLinkedListIterator;
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = std::remove_const_t<T>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = T*;
+    using reference         = T&;
+
+    constexpr StaticLinkedListIterator() : nodes_{nullptr}, current_{npos} {}
+
+    constexpr StaticLinkedListIterator(node_pointer nodes, Index current)
+        : nodes_(nodes), current_(current) {}
+
+    // iterator -> const_iterator
+    template <typename U>
+        requires (std::is_const_v<T> && std::is_same_v<const U, T>)
+    constexpr StaticLinkedListIterator(
+            const StaticLinkedListIterator<U, Index>& other)
+        : nodes_(other.nodes_), current_(other.current_) {}
+
+    constexpr T& operator*()  const { return  nodes_[current_].data; };
+    constexpr T* operator->() const { return &nodes_[current_].data; };
+
+    constexpr StaticLinkedListIterator& operator++() {
+        current_ = nodes_[current_].next;
+        return *this;
+    }
+
+    constexpr StaticLinkedListIterator operator++(int) {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    friend constexpr bool operator==(const StaticLinkedListIterator& lhs,
+                                     const StaticLinkedListIterator& rhs) {
+        return lhs.current_ == rhs.current_;
+    }
+};
+
+// Singly linked list of at most `Capacity` elements stored in an array
+// inside the list object, so it never touches the heap. Nodes link to each
+// other by index (see static_list_index_t), and freed nodes are chained
+// into a free list through the same links. Nodes that were never used are
+// taken in order from the end of the used part of the array, so creating a
+// list costs nothing per node.
+//
+// Everything is constexpr: lists can be built during constant evaluation
+// and, for trivially destructible T, kept in constexpr variables.
+//
+// Adding to a full list throws std::bad_alloc; the try_ variants report
+// LinkedListError::CapacityExceeded instead.
+template <typename T, std::size_t Capacity>
+class StaticLinkedList {
+    static_assert(Capacity > 0, "StaticLinkedList needs a capacity");
+    static_assert(Capacity < std::numeric_limits<std::uint32_t>::max());
+
+    using index_type = static_list_index_t<Capacity>;
+    using node       = StaticNode<T, index_type>;
+
+    static constexpr index_type npos{std::numeric_limits<index_type>::max()};
+
+    node       nodes_[Capacity];
+    index_type root_{npos};
+    index_type tail_{npos};
+    index_type free_{npos};
+    index_type used_{};
+    index_type size_{};
+
+    template <typename... Args>
+    constexpr index_type create_node(Args&&... args) {
+        index_type index{};
+        if (free_ != npos) {
+            index = free_;
+        } else if (used_ < Capacity) {
+            index = used_;
+        } else {
+            throw std::bad_alloc{};
+        }
+
+        std::construct_at(&nodes_[index].data, std::forward<Args>(args)...);
+        if (index == free_) {
+            free_ = nodes_[index].next;
+        } else {
+            ++used_;
+        }
+        nodes_[index].next = npos;
+        return index;
+    }
+
+    constexpr void destroy_node(index_type index) {
+        std::destroy_at(&nodes_[index].data);
+        std::construct_at(&nodes_[index].empty);
+        nodes_[index].next = free_;
+        free_ = index;
+    }
+
+    constexpr void copy_from(const StaticLinkedList& other) {
+        for (const auto& element : other) {
+            emplace_back(element);
+        }
+    }
+
+    [[nodiscard]]
+    constexpr std::expected<std::reference_wrapper<T>, LinkedListError>
+    full_error() const {
+        return std::unexpected(LinkedListError::CapacityExceeded);
+    }
+
+    friend struct std::formatter<StaticLinkedList>;
+
+public:
+    using value_type      = T;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+
+    using iterator        = StaticLinkedListIterator<T, index_type>;
+    using const_iterator  = StaticLinkedListIterator<const T, index_type>;
+
+    constexpr StaticLinkedList() = default;
+
+    explicit constexpr StaticLinkedList(T data) {
+        push_back(std::move(data));
+    }
+
+    explicit constexpr StaticLinkedList(std::initializer_list<T> elements) {
+        for (const auto& element : elements) {
+            emplace_back(element);
+        }
+    }
+
+    constexpr StaticLinkedList(const StaticLinkedList& other) {
+        copy_from(other);
+    }
+
+    // Moves the elements one by one; `other` is left empty.
+    constexpr StaticLinkedList(StaticLinkedList&& other) {
+        for (auto& element : other) {
+            emplace_back(std::move(element));
+        }
+        other.clear();
+    }
+
+    constexpr StaticLinkedList& operator=(const StaticLinkedList& other) {
+        if (this == &other) return *this;
+        clear();
+        copy_from(other);
+        return *this;
+    }
+
+    constexpr StaticLinkedList& operator=(StaticLinkedList&& other) {
+        if (this == &other) return *this;
+        clear();
+        for (auto& element : other) {
+            emplace_back(std::move(element));
+        }
+        other.clear();
+        return *this;
+    }
+
+    constexpr ~StaticLinkedList()
+        requires std::is_trivially_destructible_v<T> = default;
+    constexpr ~StaticLinkedList() { clear(); }
+
+    constexpr void clear() {
+        for (index_type current{root_}; current != npos;) {
+            const auto next = nodes_[current].next;
+            destroy_node(current);
+            current = next;
+        }
+        root_ = tail_ = free_ = npos;
+        used_ = size_ = 0;
+    }
+
+    [[nodiscard]]
+    static constexpr std::size_t capacity() { return Capacity; }
+
+    [[nodiscard]]
+    constexpr std::size_t size() const { return size_; };
+
+    [[nodiscard]]
+    constexpr auto begin() { return iterator{nodes_, root_}; }
+
+    [[nodiscard]]
+    constexpr auto end() { return iterator{nodes_, npos}; }
+
+    [[nodiscard]]
+    constexpr auto begin() const { return const_iterator{nodes_, root_}; }
+
+    [[nodiscard]]
+    constexpr auto end() const { return const_iterator{nodes_, npos}; }
+
+    [[nodiscard]]
+    constexpr auto cbegin() const { return begin(); }
+
+    [[nodiscard]]
+    constexpr auto cend() const { return end(); }
+
+    [[nodiscard]]
+    constexpr auto is_empty() const { return size_ == 0; }
+
+    [[nodiscard]]
+    constexpr auto is_full() const { return size_ == Capacity; }
+
+    [[nodiscard]]
+    constexpr auto contains(const_reference value) const {
+        return std::find(begin(), end(), value) != end();
+    }
+
+    [[nodiscard]]
+    constexpr
+    std::expected<std::reference_wrapper<value_type>, LinkedListError>
+    front() {
+        if (is_empty()) return std::unexpected(LinkedListError::EmptyList);
+        return nodes_[root_].data;
+    }
+
+    [[nodiscard]]
+    constexpr
+    std::expected<std::reference_wrapper<const value_type>, LinkedListError>
+    front() const {
+        if (is_empty()) return std::unexpected(LinkedListError::EmptyList);
+        return nodes_[root_].data;
+    }
+
+    [[nodiscard]]
+    constexpr
+    std::expected<std::reference_wrapper<value_type>, LinkedListError>
+    back() {
+        if (is_empty()) return std::unexpected(LinkedListError::EmptyList);
+        return nodes_[tail_].data;
+    }
+
+    [[nodiscard]]
+    constexpr
+    std::expected<std::reference_wrapper<const value_type>, LinkedListError>
+    back() const {
+        if (is_empty()) return std::unexpected(LinkedListError::EmptyList);
+        return nodes_[tail_].data;
+    }
+
+    constexpr void push_front(value_type data) {
+        emplace_front(std::move(data));
+    }
+
+    template <typename... Args>
+    constexpr reference emplace_front(Args&&... args) {
+        const auto index = create_node(std::forward<Args>(args)...);
+        nodes_[index].next = root_;
+        root_ = index;
+        if (tail_ == npos) tail_ = index;
+        ++size_;
+        return nodes_[index].data;
+    }
+
+    constexpr void push_back(value_type data) {
+        emplace_back(std::move(data));
+    }
+
+    template <typename... Args>
+    constexpr reference emplace_back(Args&&... args) {
+        const auto index = create_node(std::forward<Args>(args)...);
+        if (tail_ == npos) {
+            root_ = index;
+        } else {
+            nodes_[tail_].next = index;
+        }
+        tail_ = index;
+        ++size_;
+        return nodes_[index].data;
+    }
+
+    // Constructs a new element right after `pos`, which must point to an
+    // element of this list.
+    template <typename... Args>
+    constexpr iterator emplace_after(const_iterator pos, Args&&... args) {
+        const auto index = create_node(std::forward<Args>(args)...);
+        nodes_[index].next = nodes_[pos.current_].next;
+        nodes_[pos.current_].next = index;
+        if (tail_ == pos.current_) tail_ = index;
+        ++size_;
+        return iterator{nodes_, index};
+    }
+
+    template <typename... Args>
+    constexpr std::expected<std::reference_wrapper<T>, LinkedListError>
+    try_emplace_front(Args&&... args) {
+        if (is_full()) return full_error();
+        return emplace_front(std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    constexpr std::expected<std::reference_wrapper<T>, LinkedListError>
+    try_emplace_back(Args&&... args) {
+        if (is_full()) return full_error();
+        return emplace_back(std::forward<Args>(args)...);
+    }
+
+    constexpr void pop_front() {
+        if (is_empty()) return;
+
+        const auto old_root = root_;
+        root_ = nodes_[old_root].next;
+        if (root_ == npos) tail_ = npos;
+        destroy_node(old_root);
+        --size_;
+    }
+
+    constexpr void pop_back() {
+        if (is_empty()) return;
+
+        if (root_ == tail_) {
+            pop_front();
+            return;
+        }
+
+        auto prev = root_;
+        for (; nodes_[prev].next != tail_; prev = nodes_[prev].next);
+        destroy_node(tail_);
+        nodes_[prev].next = npos;
+        tail_ = prev;
+        --size_;
+    }
+
+    friend constexpr bool operator==(
+            const StaticLinkedList& lhs, const StaticLinkedList& rhs) {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    friend std::ostream& operator<<(
+            std::ostream& os, const StaticLinkedList& ll) {
+        os << "[";
+        std::for_each(std::begin(ll), std::end(ll), [&os](const auto& element) {
+            os << element << " -> "; });
+        os << "NULL]";
+        return os;
+    };
+
+    constexpr void remove(const_reference data) {
+        auto prev = npos;
+        for (auto current{root_}; current != npos;
+                prev = current, current = nodes_[current].next) {
+            if (!(nodes_[current].data == data)) continue;
+
+            if (prev == npos) {
+                pop_front();
+                return;
+            }
+            nodes_[prev].next = nodes_[current].next;
+            if (current == tail_) tail_ = prev;
+            destroy_node(current);
+            --size_;
+            return;
+        }
+    }
+
+    constexpr void remove_all(const_reference data) {
+        auto prev    = npos;
+        auto current = root_;
+
+        while (current != npos) {
+            const auto next = nodes_[current].next;
+            if (nodes_[current].data == data) {
+                destroy_node(current);
+                --size_;
+
+                if (prev == npos) {
+                    root_ = next;
+                } else {
+                    nodes_[prev].next = next;
+                }
+            } else {
+                prev = current;
+            }
+            current = next;
+        }
+        tail_ = prev;
+    }
+};
+
+template <typename T, std::size_t Capacity>
+struct std::formatter<StaticLinkedList<T, Capacity>>
+    : LinkedListFormatter<T> {};
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+
+// Instrumentation policies for LinkedList.
+//
+// The list reports node allocations and frees, how many nodes each walking
+// operation visits, and its size after it grew. A policy decides what to do
+// with these events: NoStats ignores them and takes no space in the list,
+// CountingStats counts them. Any type with the same members can be used,
+// e.g. one that forwards to process-wide counters.
+
+// Operations that walk the list and report the number of nodes they visit.
+enum class LinkedListOp : std::uint8_t {
+    GetLast,
+    Contains,
+    Remove,
+    RemoveAll,
+    PopBack,
+    Copy,
+};
+
+inline constexpr std::size_t linked_list_op_count{6};
+
+constexpr std::string_view to_string(LinkedListOp op) {
+    constexpr std::array<std::string_view, linked_list_op_count> names{
+        "get_last", "contains", "remove", "remove_all", "pop_back", "copy"};
+    return names[static_cast<std::size_t>(op)];
+}
+
+struct NoStats {
+    static constexpr bool enabled{false};
+
+    constexpr void node_allocated() noexcept {}
+    constexpr void node_freed() noexcept {}
+    constexpr void visited(LinkedListOp, std::size_t) noexcept {}
+    constexpr void size_changed(std::size_t) noexcept {}
+};
+
+// Counters of a single list. They are plain integers, so a list that is
+// read from several threads at once must not use this policy.
+class CountingStats {
+public:
+    struct Operation {
+        std::uint64_t calls{};
+        std::uint64_t nodes_visited{};
+        std::uint64_t max_nodes_visited{};
+    };
+
+private:
+    std::uint64_t allocations_{};
+    std::uint64_t frees_{};
+    std::size_t   peak_size_{};
+
+    std::array<Operation, linked_list_op_count> operations_{};
+
+public:
+    static constexpr bool enabled{true};
+
+    constexpr void node_allocated() noexcept { ++allocations_; }
+
+    constexpr void node_freed() noexcept { ++frees_; }
+
+    constexpr void visited(LinkedListOp op, std::size_t nodes) noexcept {
+        auto& counters = operations_[static_cast<std::size_t>(op)];
+        ++counters.calls;
+        counters.nodes_visited += nodes;
+        if (nodes > counters.max_nodes_visited) {
+            counters.max_nodes_visited = nodes;
+        }
+    }
+
+    constexpr void size_changed(std::size_t size) noexcept {
+        if (size > peak_size_) peak_size_ = size;
+    }
+
+    // Nodes taken from and given back to the node pool.
+    [[nodiscard]]
+    constexpr std::uint64_t allocations() const { return allocations_; }
+
+    [[nodiscard]]
+    constexpr std::uint64_t frees() const { return frees_; }
+
+    [[nodiscard]]
+    constexpr std::size_t peak_size() const { return peak_size_; }
+
+    [[nodiscard]]
+    constexpr const Operation& operation(LinkedListOp op) const {
+        return operations_[static_cast<std::size_t>(op)];
+    }
+
+    constexpr void reset() { *this = CountingStats{}; }
+
+    // Dumps the counters, one line each, skipping operations never called.
+    friend std::ostream& operator<<(
+            std::ostream& os, const CountingStats& stats) {
+        os << "allocations: " << stats.allocations_
+           << "\nfrees: " << stats.frees_
+           << "\npeak_size: " << stats.peak_size_;
+        for (std::size_t i{}; i < linked_list_op_count; ++i) {
+            const auto& counters = stats.operations_[i];
+            if (counters.calls == 0) continue;
+            os << '\n' << to_string(static_cast<LinkedListOp>(i))
+               << ": calls " << counters.calls
+               << ", nodes visited " << counters.nodes_visited
+               << ", max " << counters.max_nodes_visited;
+        }
+        return os;
+    }
+};
@@ -0,0 +1,546 @@
+#pragma once
+
+#include "LinkedList/LinkedList.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <format>
+#include <ostream>
+#include <expected>
+#include <functional>
+#include <memory>
+
+// By default a node holds about two cache lines worth of elements.
+template <typename T>
+inline constexpr std::size_t unrolled_node_capacity =
+    std::max<std::size_t>(4, 128 / sizeof(T));
+
+template <typename T, std::size_t N>
+struct UnrolledNode {
+    static_assert(N > 0, "UnrolledNode must hold at least one element");
+
+    // Only elements[first, first + count) are alive; the list constructs
+    // and destroys them explicitly.
+    union {
+        T elements[N];
+    };
+    std::size_t   first{};
+    std::size_t   count{};
+    UnrolledNode* next{};
+
+    constexpr UnrolledNode() {}
+    constexpr ~UnrolledNode() {}
+
+    UnrolledNode(const UnrolledNode&)            = delete;
+    UnrolledNode& operator=(const UnrolledNode&) = delete;
+
+    [[nodiscard]]
+    constexpr T* data() { return &elements[first]; }
+
+    [[nodiscard]]
+    constexpr const T* data() const { return &elements[first]; }
+
+    [[nodiscard]]
+    constexpr bool is_full() const { return count == N; }
+
+    // No free slot is left after the last element.
+    [[nodiscard]]
+    constexpr bool is_full_at_back() const { return first + count == N; }
+
+    // Appends at the end; the node must not be full at the back.
+    template <typename... Args>
+    constexpr void emplace_back(Args&&... args) {
+        std::construct_at(data() + count, std::forward<Args>(args)...);
+        ++count;
+    }
+
+    // Inserts at the front, shifting the other elements by one only when
+    // there is no free slot before the first; the node must not be full.
+    constexpr void push_front(T value) {
+        if (first > 0) {
+            std::construct_at(data() - 1, std::move(value));
+            --first;
+        } else if (count == 0) {
+            std::construct_at(&elements[0], std::move(value));
+        } else {
+            std::construct_at(&elements[count], std::move(elements[count - 1]));
+            std::move_backward(
+                &elements[0], &elements[count - 1], &elements[count]);
+            elements[0] = std::move(value);
+        }
+        ++count;
+    }
+
+    // Removes the element at `index` from the first, moving whichever side
+    // of it is shorter; erasing the first element moves nothing.
+    constexpr void erase(std::size_t index) {
+        const auto position = data() + index;
+        if (index < count / 2) {
+            std::move_backward(data(), position, position + 1);
+            std::destroy_at(data());
+            ++first;
+        } else {
+            std::move(position + 1, data() + count, position);
+            std::destroy_at(data() + count - 1);
+        }
+        --count;
+    }
+
+    // Moves the elements to the start of the node, freeing every slot
+    // behind them.
+    constexpr void compact() {
+        if (first == 0) return;
+        for (std::size_t i{}; i < count; ++i) {
+            std::construct_at(&elements[i], std::move(elements[first + i]));
+            std::destroy_at(&elements[first + i]);
+        }
+        first = 0;
+    }
+
+    constexpr void clear() {
+        std::destroy(data(), data() + count);
+        first = 0;
+        count = 0;
+    }
+};
+
+template <typename T, std::size_t N>
+class UnrolledLinkedListIterator {
+    using node         = std::conditional_t<
+                                std::is_const_v<T>,
+                                const UnrolledNode<std::remove_const_t<T>, N>,
+                                UnrolledNode<T, N>>;
+    using node_pointer = node*;
+
+    node_pointer current_;
+    std::size_t  index_;
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = std::remove_const_t<T>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = T*;
+    using reference         = T&;
+
+    constexpr UnrolledLinkedListIterator() : current_{nullptr}, index_{0} {}
+
+    explicit constexpr UnrolledLinkedListIterator(node_pointer current)
+        : current_(current), index_(current ? current->first : 0) {}
+
+    constexpr T& operator*()  const { return  current_->elements[index_]; };
+    constexpr T* operator->() const { return &current_->elements[index_]; };
+
+    constexpr UnrolledLinkedListIterator& operator++() {
+        if (++index_ == current_->first + current_->count) {
+            current_ = current_->next;
+            index_   = current_ ? current_->first : 0;
+        }
+        return *this;
+    }
+
+    constexpr UnrolledLinkedListIterator operator++(int) {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    friend constexpr bool operator==(
+            const UnrolledLinkedListIterator& lhs,
+            const UnrolledLinkedListIterator& rhs) {
+        return lhs.current_ == rhs.current_ && lhs.index_ == rhs.index_;
+    }
+};
+
+// Singly linked list that stores up to N elements inline in every node.
+// Traversals touch one node per N elements, and small elements no longer
+// pay for a heap block and a pointer each. Nodes that drop below half full
+// after a removal are merged with their successor when both fit in one.
+template <typename T,
+          std::size_t N = unrolled_node_capacity<T>,
+          typename Allocator = std::allocator<T>>
+class UnrolledLinkedList {
+    using node         = UnrolledNode<T, N>;
+    using node_pointer = node*;
+
+    using node_allocator   =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+    using node_traits      = std::allocator_traits<node_allocator>;
+
+    node_pointer root_{};
+    node_pointer tail_{};
+    std::size_t  size_{};
+
+    [[no_unique_address]] node_allocator alloc_{};
+
+    constexpr node_pointer create_node(node_pointer next = nullptr) {
+        const auto new_node = node_traits::allocate(alloc_, 1);
+        node_traits::construct(alloc_, new_node);
+        new_node->next = next;
+        return new_node;
+    }
+
+    constexpr void destroy_node(node_pointer n) {
+        n->clear();
+        node_traits::destroy(alloc_, n);
+        node_traits::deallocate(alloc_, n, 1);
+    }
+
+    constexpr void copy_from(const UnrolledLinkedList& other) {
+        for (const auto& element : other) {
+            push_back(element);
+        }
+    }
+
+    // Unlinks `n`, whose predecessor is `prev` (nullptr for the root).
+    constexpr void unlink(node_pointer prev, node_pointer n) {
+        if (prev) {
+            prev->next = n->next;
+        } else {
+            root_ = n->next;
+        }
+        if (tail_ == n) tail_ = prev;
+        destroy_node(n);
+    }
+
+    // Restores the fill invariant of `n` after elements were erased from
+    // it: empty nodes are unlinked and a node less than half full absorbs
+    // its successor when their elements fit in one node.
+    constexpr void rebalance(node_pointer prev, node_pointer n) {
+        if (n->count == 0) {
+            unlink(prev, n);
+        } else if (can_absorb_next(n)) {
+            absorb_next(n);
+        }
+    }
+
+    [[nodiscard]]
+    constexpr bool can_absorb_next(node_pointer n) const {
+        return n->next && n->count < N / 2 && n->count + n->next->count <= N;
+    }
+
+    constexpr void absorb_next(node_pointer n) {
+        const auto next = n->next;
+        if (n->first + n->count + next->count > N) n->compact();
+        for (std::size_t i{}; i < next->count; ++i) {
+            n->emplace_back(std::move(next->data()[i]));
+        }
+        unlink(n, next);
+    }
+
+    friend struct std::formatter<UnrolledLinkedList>;
+
+public:
+    using value_type      = T;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using allocator_type  = Allocator;
+
+    using iterator        = UnrolledLinkedListIterator<T, N>;
+    using const_iterator  = UnrolledLinkedListIterator<const T, N>;
+
+    static constexpr std::size_t node_capacity = N;
+
+    constexpr UnrolledLinkedList() : root_{nullptr}, tail_{nullptr}, size_{0} {}
+
+    explicit constexpr UnrolledLinkedList(const Allocator& alloc)
+        : root_{nullptr}, tail_{nullptr}, size_{0}, alloc_{alloc} {}
+
+    explicit UnrolledLinkedList(T data, const Allocator& alloc = Allocator())
+            : UnrolledLinkedList(alloc) {
+        push_back(std::move(data));
+    }
+
+    explicit constexpr UnrolledLinkedList(std::initializer_list<T> elements,
+                                          const Allocator& alloc = Allocator())
+            : UnrolledLinkedList(alloc) {
+        try {
+            for (const auto& element : elements) {
+                push_back(element);
+            }
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+    constexpr UnrolledLinkedList(const UnrolledLinkedList& other)
+            : UnrolledLinkedList(
+                node_traits::select_on_container_copy_construction(
+                    other.alloc_)) {
+        try {
+            copy_from(other);
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+    constexpr UnrolledLinkedList& operator=(const UnrolledLinkedList& other) {
+        if (this == &other) return *this;
+
+        clear();
+        if constexpr (
+                node_traits::propagate_on_container_copy_assignment::value) {
+            alloc_ = other.alloc_;
+        }
+        copy_from(other);
+        return *this;
+    }
+
+    constexpr UnrolledLinkedList(UnrolledLinkedList&& other) noexcept
+        : root_{std::exchange(other.root_, nullptr)},
+          tail_{std::exchange(other.tail_, nullptr)},
+          size_{std::exchange(other.size_, 0)},
+          alloc_{std::move(other.alloc_)}
+    {}
+
+    constexpr UnrolledLinkedList& operator=(UnrolledLinkedList&& other)
+            noexcept(
+                node_traits::propagate_on_container_move_assignment::value ||
+                node_traits::is_always_equal::value) {
+        if (this == &other) return *this;
+
+        clear();
+        if constexpr (
+                node_traits::propagate_on_container_move_assignment::value) {
+            alloc_ = std::move(other.alloc_);
+        } else if (alloc_ != other.alloc_) {
+            for (auto& element : other) {
+                push_back(std::move(element));
+            }
+            other.clear();
+            return *this;
+        }
+        root_ = std::exchange(other.root_, nullptr);
+        tail_ = std::exchange(other.tail_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        return *this;
+    }
+
+    constexpr ~UnrolledLinkedList() { clear(); }
+
+    [[nodiscard]]
+    constexpr allocator_type get_allocator() const {
+        return allocator_type(alloc_);
+    }
+
+    constexpr void clear() {
+        for (node_pointer current{root_}; current;) {
+            const auto next = current->next;
+            destroy_node(current);
+            current = next;
+        }
+        root_ = nullptr;
+        tail_ = nullptr;
+        size_ = 0;
+    }
+
+    friend constexpr void swap(
+            UnrolledLinkedList& l1, UnrolledLinkedList& l2) noexcept {
+        using std::swap;
+        if constexpr (node_traits::propagate_on_container_swap::value) {
+            swap(l1.alloc_, l2.alloc_);
+        }
+        swap(l1.root_, l2.root_);
+        swap(l1.tail_, l2.tail_);
+        swap(l1.size_, l2.size_);
+    }
+
+    [[nodiscard]]
+    constexpr std::size_t size() const { return size_; };
+
+    [[nodiscard]]
+    constexpr auto begin() { return iterator{root_}; }
+
+    [[nodiscard]]
+    constexpr auto end() { return iterator{nullptr}; }
+
+    [[nodiscard]]
+    constexpr auto begin() const { return const_iterator{root_}; }
+
+    [[nodiscard]]
+    constexpr auto end() const { return const_iterator{nullptr}; }
+
+    [[nodiscard]]
+    constexpr auto is_empty() const { return root_ == nullptr; }
+
+    [[nodiscard]]
+    constexpr auto contains(const_reference value) const {
+        for (node_pointer current{root_}; current; current = current->next) {
+            const auto first = current->data();
+            const auto last  = first + current->count;
+            if (std::find(first, last, value) != last) return true;
+        }
+        return false;
+    }
+
+    [[nodiscard]]
+    std::expected<std::reference_wrapper<value_type>, LinkedListError>
+    front() {
+        if (!root_) return std::unexpected(LinkedListError::EmptyList);
+        return *root_->data();
+    }
+
+    [[nodiscard]]
+    std::expected<std::reference_wrapper<const value_type>, LinkedListError>
+    front() const {
+        if (!root_) return std::unexpected(LinkedListError::EmptyList);
+        return *root_->data();
+    }
+
+    [[nodiscard]]
+    std::expected<std::reference_wrapper<value_type>, LinkedListError>
+    back() {
+        if (!tail_) return std::unexpected(LinkedListError::EmptyList);
+        return tail_->data()[tail_->count - 1];
+    }
+
+    [[nodiscard]]
+    std::expected<std::reference_wrapper<const value_type>, LinkedListError>
+    back() const {
+        if (!tail_) return std::unexpected(LinkedListError::EmptyList);
+        return tail_->data()[tail_->count - 1];
+    }
+
+    void push_front(value_type data) {
+        if (root_ && !root_->is_full()) {
+            root_->push_front(std::move(data));
+            ++size_;
+            return;
+        }
+
+        // A new node is linked in only once it holds the element. It is
+        // filled from the back so that further push_front calls take the
+        // free slots before it.
+        const auto new_node = create_node(root_);
+        try {
+            new_node->first = root_ ? N - 1 : 0;
+            new_node->emplace_back(std::move(data));
+        } catch (...) {
+            destroy_node(new_node);
+            throw;
+        }
+        root_ = new_node;
+        if (!tail_) tail_ = root_;
+        ++size_;
+    }
+
+    void pop_front() {
+        if (!root_) return;
+
+        root_->erase(0);
+        --size_;
+        rebalance(nullptr, root_);
+    }
+
+    void push_back(value_type data) {
+        // Elements popped from the front leave free slots there; moving a
+        // node that is at most half full back to its start is cheaper
+        // than starting a new one.
+        if (tail_ && tail_->is_full_at_back() && tail_->count <= N / 2) {
+            tail_->compact();
+        }
+        if (tail_ && !tail_->is_full_at_back()) {
+            tail_->emplace_back(std::move(data));
+            ++size_;
+            return;
+        }
+
+        const auto new_node = create_node();
+        try {
+            new_node->emplace_back(std::move(data));
+        } catch (...) {
+            destroy_node(new_node);
+            throw;
+        }
+        if (tail_) {
+            tail_->next = new_node;
+        } else {
+            root_ = new_node;
+        }
+        tail_ = new_node;
+        ++size_;
+    }
+
+    void pop_back() {
+        if (!tail_) return;
+
+        --size_;
+        if (tail_->count > 1) {
+            tail_->erase(tail_->count - 1);
+            return;
+        }
+
+        // Singly linked: the predecessor of the tail node still has to be
+        // found, but only once per N elements.
+        node_pointer prev{nullptr};
+        if (root_ != tail_) {
+            for (prev = root_; prev->next != tail_; prev = prev->next);
+        }
+        unlink(prev, tail_);
+    }
+
+    friend constexpr auto operator==(
+            const UnrolledLinkedList& lhs, const UnrolledLinkedList& rhs) {
+        if (lhs.size() != rhs.size()) return false;
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    friend std::ostream& operator<<(
+            std::ostream& os, const UnrolledLinkedList& ll) {
+        os << "[";
+        for (const auto& element : ll) {
+            os << element << " -> ";
+        }
+        os << "NULL]";
+        return os;
+    };
+
+    void remove(const_reference data) {
+        for (node_pointer prev{nullptr}, current{root_}; current;
+                prev = current, current = current->next) {
+            const auto first = current->data();
+            const auto last  = first + current->count;
+            const auto found = std::find(first, last, data);
+            if (found == last) continue;
+
+            current->erase(static_cast<std::size_t>(found - first));
+            --size_;
+            rebalance(prev, current);
+            return;
+        }
+    }
+
+    void remove_all(const_reference data) {
+        for (auto current{root_}; current; current = current->next) {
+            const auto first   = current->data();
+            const auto last    = first + current->count;
+            const auto kept    = std::remove(first, last, data);
+            const auto removed = static_cast<std::size_t>(last - kept);
+
+            std::destroy(kept, last);
+            current->count -= removed;
+            size_          -= removed;
+        }
+
+        // Second pass: drop emptied nodes and merge underfilled neighbours.
+        node_pointer prev{nullptr};
+        for (auto current{root_}; current;) {
+            if (current->count == 0) {
+                const auto next = current->next;
+                unlink(prev, current);
+                current = next;
+            } else if (can_absorb_next(current)) {
+                absorb_next(current);
+            } else {
+                prev    = current;
+                current = current->next;
+            }
+        }
+    }
+};
+
+template <typename T, std::size_t N, typename Allocator>
+struct std::formatter<UnrolledLinkedList<T, N, Allocator>>
+    : LinkedListFormatter<T> {};
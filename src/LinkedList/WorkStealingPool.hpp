@@ -0,0 +1,209 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads, each with its own deque of jobs. A worker
+// takes jobs from the back of its own deque and, when that is empty, steals
+// from the front of the others', so a worker that finishes its share early
+// takes over work left behind by slower ones.
+//
+// Work is submitted in batches with run(): the jobs are dealt round-robin
+// to the workers and the calling thread helps running them until the whole
+// batch is done. Since the caller never just blocks, run() may also be
+// called from inside a job.
+class WorkStealingPool {
+    // A job is one index of a batch; the batch knows what to do with it.
+    struct batch_base {
+        std::atomic<std::size_t> remaining;
+        std::exception_ptr       error{};
+        std::mutex               error_mutex{};
+
+        explicit batch_base(std::size_t count) : remaining{count} {}
+
+        virtual void run(std::size_t index) = 0;
+
+        // Returns whether this was the last job of the batch. The batch may
+        // be gone as soon as the last job is counted.
+        bool execute(std::size_t index) {
+            try {
+                run(index);
+            } catch (...) {
+                const std::lock_guard lock{error_mutex};
+                if (!error) error = std::current_exception();
+            }
+            return remaining.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        }
+
+    protected:
+        ~batch_base() = default;
+    };
+
+    template <typename Task>
+    struct batch final : batch_base {
+        Task& task;
+
+        batch(std::size_t count, Task& t) : batch_base{count}, task{t} {}
+
+        void run(std::size_t index) override { task(index); }
+    };
+
+    struct job {
+        batch_base* owner;
+        std::size_t index;
+    };
+
+    struct worker_queue {
+        std::mutex      mutex;
+        std::deque<job> jobs;
+    };
+
+    std::vector<std::unique_ptr<worker_queue>> queues_;
+    std::vector<std::jthread>                  workers_;
+
+    std::atomic<std::size_t> queued_{};
+    std::mutex               sleep_mutex_;
+    std::condition_variable  wake_;
+    bool                     stopping_{};
+
+    std::mutex               done_mutex_;
+    std::condition_variable  done_;
+
+    std::atomic<std::size_t> next_queue_{};
+
+    void execute(const job& next) {
+        if (next.owner->execute(next.index)) {
+            { const std::lock_guard lock{done_mutex_}; }
+            done_.notify_all();
+        }
+    }
+
+    std::optional<job> pop_own(std::size_t queue) {
+        auto& q = *queues_[queue];
+        const std::lock_guard lock{q.mutex};
+        if (q.jobs.empty()) return std::nullopt;
+        const auto result = q.jobs.back();
+        q.jobs.pop_back();
+        queued_.fetch_sub(1, std::memory_order_relaxed);
+        return result;
+    }
+
+    // Tries every queue starting with `first`.
+    std::optional<job> steal(std::size_t first) {
+        for (std::size_t i{}; i < queues_.size(); ++i) {
+            auto& q = *queues_[(first + i) % queues_.size()];
+            const std::lock_guard lock{q.mutex};
+            if (q.jobs.empty()) continue;
+            const auto result = q.jobs.front();
+            q.jobs.pop_front();
+            queued_.fetch_sub(1, std::memory_order_relaxed);
+            return result;
+        }
+        return std::nullopt;
+    }
+
+    void work(std::size_t self) {
+        for (;;) {
+            auto next = pop_own(self);
+            if (!next) next = steal(self + 1);
+            if (next) {
+                execute(*next);
+                continue;
+            }
+
+            std::unique_lock lock{sleep_mutex_};
+            wake_.wait(lock, [this] {
+                return stopping_ ||
+                       queued_.load(std::memory_order_relaxed) != 0;
+            });
+            if (stopping_) return;
+        }
+    }
+
+    void submit(batch_base& owner, std::size_t count) {
+        const auto first =
+            next_queue_.fetch_add(1, std::memory_order_relaxed);
+        for (std::size_t i{}; i < queues_.size() && i < count; ++i) {
+            auto& q = *queues_[(first + i) % queues_.size()];
+            const std::lock_guard lock{q.mutex};
+            // Queue i gets the indices i, i + n, i + 2n, ...
+            for (auto index{i}; index < count; index += queues_.size()) {
+                q.jobs.push_back(job{&owner, index});
+                queued_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        { const std::lock_guard lock{sleep_mutex_}; }
+        wake_.notify_all();
+    }
+
+public:
+    explicit WorkStealingPool(
+            std::size_t threads = std::thread::hardware_concurrency()) {
+        threads = std::max<std::size_t>(threads, 1);
+        queues_.reserve(threads);
+        for (std::size_t i{}; i < threads; ++i) {
+            queues_.push_back(std::make_unique<worker_queue>());
+        }
+        workers_.reserve(threads);
+        for (std::size_t i{}; i < threads; ++i) {
+            workers_.emplace_back([this, i] { work(i); });
+        }
+    }
+
+    WorkStealingPool(const WorkStealingPool&)            = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    // Jobs still queued are dropped; no run() may be in progress.
+    ~WorkStealingPool() {
+        {
+            const std::lock_guard lock{sleep_mutex_};
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        workers_.clear();
+    }
+
+    [[nodiscard]]
+    std::size_t thread_count() const { return workers_.size(); }
+
+    // Calls task(i) for every i in [0, count), possibly concurrently, and
+    // returns once all calls returned. If calls throw, the first exception
+    // is rethrown after the others finished.
+    template <typename Task>
+    void run(std::size_t count, Task task) {
+        if (count == 0) return;
+
+        batch<Task> work{count, task};
+        submit(work, count);
+
+        const auto finished = [&work] {
+            return work.remaining.load(std::memory_order_acquire) == 0;
+        };
+        for (std::size_t start{}; !finished(); ++start) {
+            if (const auto next = steal(start)) {
+                execute(*next);
+                continue;
+            }
+            // Everything left is running on the workers.
+            std::unique_lock lock{done_mutex_};
+            done_.wait(lock, finished);
+        }
+
+        if (work.error) std::rethrow_exception(work.error);
+    }
+
+    // Pool shared by the parallel algorithms unless they are given one.
+    static WorkStealingPool& shared() {
+        static WorkStealingPool pool{};
+        return pool;
+    }
+};
@@ -0,0 +1,149 @@
+#include "LinkedList/ConcurrentLinkedQueue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <format>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Moving it throws while `fail` is set.
+struct ThrowingMove {
+    static inline bool fail{};
+
+    std::shared_ptr<int> counter;
+
+    explicit ThrowingMove(std::shared_ptr<int> c) : counter{std::move(c)} {}
+
+    ThrowingMove(ThrowingMove&& other) : counter{other.counter} {
+        if (fail) throw std::runtime_error{"move"};
+        other.counter.reset();
+    }
+};
+
+}
+
+TEST(ConcurrentLinkedQueue, canCreateEmptyQueue) {
+    ConcurrentLinkedQueue<int> queue{};
+
+    EXPECT_TRUE(queue.is_empty());
+    EXPECT_FALSE(queue.try_pop_front().has_value());
+}
+
+TEST(ConcurrentLinkedQueue, popsInFifoOrder) {
+    ConcurrentLinkedQueue<std::string> queue{};
+
+    queue.push_back("a");
+    queue.push_back("b");
+    queue.emplace_back(3, 'c');
+
+    EXPECT_FALSE(queue.is_empty());
+    EXPECT_EQ(queue.try_pop_front(), "a");
+    EXPECT_EQ(queue.try_pop_front(), "b");
+    EXPECT_EQ(queue.try_pop_front(), "ccc");
+    EXPECT_FALSE(queue.try_pop_front().has_value());
+    EXPECT_TRUE(queue.is_empty());
+
+    queue.push_back("d");
+    EXPECT_EQ(queue.try_pop_front(), "d");
+}
+
+TEST(ConcurrentLinkedQueue, popFrontIntoLinkedList) {
+    ConcurrentLinkedQueue<int> queue{};
+    for (int i{}; i < 5; ++i) {
+        queue.push_back(i);
+    }
+
+    LinkedList<int> batch{};
+    EXPECT_EQ(queue.pop_front_into(batch, 3), 3);
+    EXPECT_EQ(std::format("{}", batch), "[0 -> 1 -> 2 -> NULL]");
+
+    EXPECT_EQ(queue.pop_front_into(batch, 10), 2);
+    EXPECT_EQ(std::format("{}", batch), "[0 -> 1 -> 2 -> 3 -> 4 -> NULL]");
+    EXPECT_TRUE(queue.is_empty());
+}
+
+TEST(ConcurrentLinkedQueue, elementsAreDestroyedOnce) {
+    auto counter = std::make_shared<int>(0);
+    {
+        ConcurrentLinkedQueue<std::shared_ptr<int>> queue{};
+        queue.push_back(counter);
+        queue.push_back(counter);
+        queue.push_back(counter);
+        EXPECT_EQ(counter.use_count(), 4);
+
+        EXPECT_TRUE(queue.try_pop_front().has_value());
+        EXPECT_EQ(counter.use_count(), 3);
+    }
+    EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(ConcurrentLinkedQueue, concurrentProducersKeepTheirOrder) {
+    constexpr int producers{4};
+    constexpr int consumers{4};
+    constexpr int per_producer{20'000};
+
+    ConcurrentLinkedQueue<std::pair<int, int>> queue{};
+    std::atomic<int> popped{};
+    std::atomic<bool> in_order{true};
+    std::vector<std::atomic<int>> seen(producers * per_producer);
+
+    std::vector<std::thread> threads;
+    for (int p{}; p < producers; ++p) {
+        threads.emplace_back([&queue, p] {
+            for (int i{}; i < per_producer; ++i) {
+                queue.emplace_back(p, i);
+            }
+        });
+    }
+    for (int c{}; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            std::vector<int> last(producers, -1);
+            while (popped.load() < producers * per_producer) {
+                if (const auto element = queue.try_pop_front()) {
+                    const auto [p, i] = *element;
+                    // FIFO: one consumer sees each producer's elements in
+                    // increasing order.
+                    if (i <= last[p]) in_order = false;
+                    last[p] = i;
+                    seen[p * per_producer + i].fetch_add(1);
+                    popped.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_TRUE(queue.is_empty());
+    EXPECT_TRUE(in_order.load());
+    for (const auto& count : seen) {
+        ASSERT_EQ(count.load(), 1);
+    }
+}
+
+TEST(ConcurrentLinkedQueue, nodeIsReclaimedWhenMovingElementOutThrows) {
+    auto counter = std::make_shared<int>(0);
+    {
+        ConcurrentLinkedQueue<ThrowingMove> queue{};
+        queue.push_back(ThrowingMove{counter});
+
+        ThrowingMove::fail = true;
+        EXPECT_THROW((void)queue.try_pop_front(), std::runtime_error);
+        ThrowingMove::fail = false;
+        EXPECT_TRUE(queue.is_empty());
+
+        // Enough retired nodes for the thread to reclaim its batch.
+        for (int i{}; i < 1'000; ++i) {
+            queue.push_back(ThrowingMove{nullptr});
+            EXPECT_TRUE(queue.try_pop_front().has_value());
+        }
+        EXPECT_EQ(counter.use_count(), 1);
+    }
+}
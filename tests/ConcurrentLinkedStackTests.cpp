@@ -0,0 +1,137 @@
+#include "LinkedList/ConcurrentLinkedStack.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Moving it throws while `fail` is set.
+struct ThrowingMove {
+    static inline bool fail{};
+
+    std::shared_ptr<int> counter;
+
+    explicit ThrowingMove(std::shared_ptr<int> c) : counter{std::move(c)} {}
+
+    ThrowingMove(ThrowingMove&& other) : counter{other.counter} {
+        if (fail) throw std::runtime_error{"move"};
+        other.counter.reset();
+    }
+};
+
+}
+
+TEST(ConcurrentLinkedStack, canCreateEmptyStack) {
+    ConcurrentLinkedStack<int> stack{};
+
+    EXPECT_TRUE(stack.is_empty());
+    EXPECT_FALSE(stack.try_pop_front().has_value());
+}
+
+TEST(ConcurrentLinkedStack, popsInLifoOrder) {
+    ConcurrentLinkedStack<std::string> stack{};
+
+    stack.push_front("a");
+    stack.push_front("b");
+    stack.emplace_front(3, 'c');
+
+    EXPECT_FALSE(stack.is_empty());
+    EXPECT_EQ(stack.try_pop_front(), "ccc");
+    EXPECT_EQ(stack.try_pop_front(), "b");
+    EXPECT_EQ(stack.try_pop_front(), "a");
+    EXPECT_FALSE(stack.try_pop_front().has_value());
+    EXPECT_TRUE(stack.is_empty());
+}
+
+TEST(ConcurrentLinkedStack, pushRangeBehavesLikeRepeatedPushFront) {
+    ConcurrentLinkedStack<int> stack{};
+    stack.push_front(0);
+
+    stack.push_range(std::vector{1, 2, 3});
+    stack.push_range(std::vector<int>{});
+
+    EXPECT_EQ(stack.try_pop_front(), 3);
+    EXPECT_EQ(stack.try_pop_front(), 2);
+    EXPECT_EQ(stack.try_pop_front(), 1);
+    EXPECT_EQ(stack.try_pop_front(), 0);
+    EXPECT_FALSE(stack.try_pop_front().has_value());
+}
+
+TEST(ConcurrentLinkedStack, remainingElementsAreDestroyed) {
+    auto counter = std::make_shared<int>(0);
+    {
+        ConcurrentLinkedStack<std::shared_ptr<int>> stack{};
+        stack.push_front(counter);
+        stack.push_front(counter);
+        EXPECT_EQ(counter.use_count(), 3);
+    }
+    EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(ConcurrentLinkedStack, concurrentPushAndPopLoseNothing) {
+    constexpr int threads_per_side{4};
+    constexpr int per_producer{20'000};
+
+    ConcurrentLinkedStack<int> stack{};
+    std::atomic<int>  popped{};
+    std::vector<std::atomic<int>> seen(threads_per_side * per_producer);
+
+    std::vector<std::thread> threads;
+    for (int p{}; p < threads_per_side; ++p) {
+        threads.emplace_back([&stack, p] {
+            for (int i{}; i < per_producer; i += 2) {
+                const auto value = p * per_producer + i;
+                if (i % 4 == 0) {
+                    stack.push_range(std::vector{value, value + 1});
+                } else {
+                    stack.push_front(value);
+                    stack.push_front(value + 1);
+                }
+            }
+        });
+    }
+    for (int c{}; c < threads_per_side; ++c) {
+        threads.emplace_back([&] {
+            while (popped.load() < threads_per_side * per_producer) {
+                if (const auto value = stack.try_pop_front()) {
+                    seen[*value].fetch_add(1);
+                    popped.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_TRUE(stack.is_empty());
+    for (const auto& count : seen) {
+        ASSERT_EQ(count.load(), 1);
+    }
+}
+
+TEST(ConcurrentLinkedStack, nodeIsReclaimedWhenMovingElementOutThrows) {
+    auto counter = std::make_shared<int>(0);
+    {
+        ConcurrentLinkedStack<ThrowingMove> stack{};
+        stack.push_front(ThrowingMove{counter});
+
+        ThrowingMove::fail = true;
+        EXPECT_THROW((void)stack.try_pop_front(), std::runtime_error);
+        ThrowingMove::fail = false;
+        EXPECT_TRUE(stack.is_empty());
+
+        // Enough retired nodes for the thread to reclaim its batch.
+        for (int i{}; i < 1'000; ++i) {
+            stack.push_front(ThrowingMove{nullptr});
+            EXPECT_TRUE(stack.try_pop_front().has_value());
+        }
+        EXPECT_EQ(counter.use_count(), 1);
+    }
+}
@@ -0,0 +1,190 @@
+#include "LinkedList/DoublyLinkedList.hpp"
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <any>
+#include <format>
+#include <memory_resource>
+#include <ranges>
+#include <string>
+#include <sstream>
+#include <vector>
+
+TEST(DoublyLinkedList, canCreateEmptyList) {
+    DoublyLinkedList<int> ll{};
+
+    EXPECT_TRUE(ll.is_empty());
+    EXPECT_EQ(ll.size(), 0);
+    EXPECT_EQ(ll.begin(), ll.end());
+    EXPECT_EQ(ll.front(), std::unexpected(LinkedListError::EmptyList));
+    EXPECT_EQ(ll.back(), std::unexpected(LinkedListError::EmptyList));
+    EXPECT_EQ(std::format("{}", ll), "[NULL]");
+}
+
+TEST(DoublyLinkedList, shouldDeduceType) {
+    DoublyLinkedList ll{7};
+
+    EXPECT_EQ(ll.size(), 1);
+    EXPECT_EQ(ll.front(), 7);
+    EXPECT_EQ(ll.back(), 7);
+}
+
+TEST(DoublyLinkedList, pushAndPopAtBothEnds) {
+    DoublyLinkedList<int> ll{};
+
+    ll.push_back(2);
+    ll.push_front(1);
+    ll.push_back(3);
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 2 -> 3 -> NULL]");
+
+    ll.pop_back();
+    EXPECT_EQ(ll.back(), 2);
+    ll.pop_front();
+    EXPECT_EQ(ll.front(), 2);
+    EXPECT_EQ(ll.back(), 2);
+    ll.pop_back();
+    EXPECT_TRUE(ll.is_empty());
+
+    ll.pop_back();
+    ll.pop_front();
+    EXPECT_TRUE(ll.is_empty());
+}
+
+TEST(DoublyLinkedList, drainFromBack) {
+    DoublyLinkedList<int> ll{};
+    for (int i{}; i < 100'000; ++i) {
+        ll.push_back(i);
+    }
+
+    long long sum{};
+    while (!ll.is_empty()) {
+        sum += *ll.back();
+        ll.pop_back();
+    }
+    EXPECT_EQ(sum, 4'999'950'000LL);
+}
+
+TEST(DoublyLinkedList, iteratesBackwards) {
+    static_assert(std::bidirectional_iterator<DoublyLinkedList<int>::iterator>);
+    static_assert(
+        std::ranges::bidirectional_range<const DoublyLinkedList<int>>);
+
+    const DoublyLinkedList ll{1, 2, 3};
+
+    std::vector<int> reversed;
+    for (const auto element : ll | std::views::reverse) {
+        reversed.push_back(element);
+    }
+    EXPECT_EQ(reversed, (std::vector{3, 2, 1}));
+    EXPECT_EQ(*ll.rbegin(), 3);
+    EXPECT_EQ(*--ll.end(), 3);
+}
+
+TEST(DoublyLinkedList, insertAndErase) {
+    DoublyLinkedList ll{1, 3};
+
+    auto it = ll.insert(++ll.begin(), 2);
+    EXPECT_EQ(*it, 2);
+    ll.emplace(ll.end(), 4);
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 2 -> 3 -> 4 -> NULL]");
+
+    it = ll.erase(it);
+    EXPECT_EQ(*it, 3);
+    ll.erase(--ll.end());
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 3 -> NULL]");
+    EXPECT_EQ(ll.back(), 3);
+    EXPECT_EQ(ll.size(), 2);
+}
+
+TEST(DoublyLinkedList, removeAndRemoveAll) {
+    DoublyLinkedList ll{1, 2, 1, 3, 1};
+
+    ll.remove(1);
+    EXPECT_EQ(std::format("{}", ll), "[2 -> 1 -> 3 -> 1 -> NULL]");
+
+    ll.remove_all(1);
+    EXPECT_EQ(std::format("{}", ll), "[2 -> 3 -> NULL]");
+    EXPECT_EQ(ll.size(), 2);
+    EXPECT_TRUE(ll.contains(3));
+    EXPECT_FALSE(ll.contains(1));
+}
+
+TEST(DoublyLinkedList, spliceMovesEntryToFront) {
+    DoublyLinkedList<std::string> lru{"a", "b", "c"};
+
+    // "c" is used: move it to the front.
+    lru.splice(lru.begin(), lru, --lru.end());
+    EXPECT_EQ(std::format("{}", lru), "[c -> a -> b -> NULL]");
+
+    // Evict the least recently used entry.
+    lru.pop_back();
+    EXPECT_EQ(std::format("{}", lru), "[c -> a -> NULL]");
+
+    lru.splice(lru.begin(), lru, lru.begin());
+    EXPECT_EQ(std::format("{}", lru), "[c -> a -> NULL]");
+
+    DoublyLinkedList<std::string> other{"x"};
+    lru.splice(lru.end(), other, other.begin());
+    EXPECT_TRUE(other.is_empty());
+    EXPECT_EQ(lru.size(), 3);
+    EXPECT_EQ(lru.back()->get(), "x");
+}
+
+TEST(DoublyLinkedList, copyMoveAndSwap) {
+    DoublyLinkedList l1{1, 2};
+    auto l2 = l1;
+    l2.push_back(3);
+    EXPECT_EQ(std::format("{}", l1), "[1 -> 2 -> NULL]");
+
+    auto l3 = std::move(l2);
+    EXPECT_TRUE(l2.is_empty());
+    EXPECT_EQ(std::format("{}", l3), "[1 -> 2 -> 3 -> NULL]");
+    l3.pop_back();
+    EXPECT_EQ(l3, l1);
+
+    swap(l1, l2);
+    EXPECT_TRUE(l1.is_empty());
+    EXPECT_EQ(std::format("{}", l2), "[1 -> 2 -> NULL]");
+    EXPECT_EQ(*--l2.end(), 2);
+
+    l1 = l2;
+    l2 = std::move(l3);
+    EXPECT_EQ(l1, l2);
+}
+
+TEST(DoublyLinkedList, swapOfElementsConstructibleFromAllocator) {
+    DoublyLinkedList<std::any> l1{};
+    DoublyLinkedList<std::any> l2{};
+    l1.push_back(1);
+
+    swap(l1, l2);
+
+    EXPECT_TRUE(l1.is_empty());
+    EXPECT_EQ(l2.size(), 1);
+}
+
+TEST(DoublyLinkedList, pmrMoveWithOtherResourceMovesElements) {
+    std::pmr::monotonic_buffer_resource r1;
+    std::pmr::monotonic_buffer_resource r2;
+
+    pmr::DoublyLinkedList<std::pmr::string> l1{&r1};
+    l1.push_back("a long string that does not fit into SSO");
+    l1.push_back("b");
+
+    pmr::DoublyLinkedList<std::pmr::string> l2{std::move(l1), &r2};
+
+    EXPECT_TRUE(l1.is_empty());
+    EXPECT_EQ(l2.size(), 2);
+    EXPECT_EQ(l2.back()->get(), "b");
+    EXPECT_EQ(l2.get_allocator().resource(), &r2);
+}
+
+TEST(DoublyLinkedList, outputStream) {
+    DoublyLinkedList ll{1, 2};
+    std::ostringstream os;
+
+    os << ll;
+
+    EXPECT_EQ(os.str(), "[1 -> 2 -> NULL]");
+}
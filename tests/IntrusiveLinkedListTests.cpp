@@ -0,0 +1,278 @@
+#include "LinkedList/IntrusiveLinkedList.hpp"
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <format>
+#include <string>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+struct Item : LinkedListHook {
+    int value;
+
+    explicit Item(int value) : value{value} {}
+
+    friend bool operator==(const Item& lhs, const Item& rhs) {
+        return lhs.value == rhs.value;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const Item& item) {
+        return os << item.value;
+    }
+};
+
+struct Task {
+    std::string    name;
+    LinkedListHook ready_hook;
+    LinkedListHook all_hook;
+
+    friend bool operator==(const Task& lhs, const Task& rhs) {
+        return lhs.name == rhs.name;
+    }
+};
+
+using ReadyList = IntrusiveLinkedList<Task, MemberHook<&Task::ready_hook>>;
+using AllList   = IntrusiveLinkedList<Task, MemberHook<&Task::all_hook>>;
+
+// Neither standard layout nor default constructible.
+struct Job : Item {
+    std::string    owner;
+    LinkedListHook hook;
+
+    Job(int value, std::string owner) : Item{value}, owner{std::move(owner)} {}
+    virtual ~Job() = default;
+};
+
+struct Tagged {
+    long tag{};
+};
+
+// The hook sits behind two non-empty bases and another member.
+struct TaggedJob : Tagged, Job {
+    char           priority{};
+    LinkedListHook tagged_hook;
+
+    TaggedJob(int value, std::string owner) : Job{value, std::move(owner)} {}
+};
+
+}
+
+template <>
+struct std::formatter<Item> : std::formatter<int> {
+    auto format(const Item& item, std::format_context& ctx) const {
+        return std::formatter<int>::format(item.value, ctx);
+    }
+};
+
+TEST(IntrusiveLinkedList, canCreateEmptyList) {
+    IntrusiveLinkedList<Item> ll{};
+
+    EXPECT_TRUE(ll.is_empty());
+    EXPECT_EQ(ll.size(), 0);
+    EXPECT_EQ(ll.begin(), ll.end());
+    EXPECT_EQ(ll.front(), std::unexpected(LinkedListError::EmptyList));
+    EXPECT_EQ(ll.back(), std::unexpected(LinkedListError::EmptyList));
+    EXPECT_EQ(std::format("{}", ll), "[NULL]");
+}
+
+TEST(IntrusiveLinkedList, linksExistingObjects) {
+    Item a{1}, b{2}, c{3};
+    IntrusiveLinkedList<Item> ll{};
+
+    ll.push_back(b);
+    ll.push_front(a);
+    ll.push_back(c);
+
+    EXPECT_EQ(ll.size(), 3);
+    EXPECT_EQ(&ll.front()->get(), &a);
+    EXPECT_EQ(&ll.back()->get(), &c);
+    EXPECT_TRUE(b.is_linked());
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 2 -> 3 -> NULL]");
+
+    std::ostringstream os;
+    os << ll;
+    EXPECT_EQ(os.str(), "[1 -> 2 -> 3 -> NULL]");
+
+    // Changes to the objects are visible through the list.
+    b.value = 20;
+    EXPECT_TRUE(ll.contains(Item{20}));
+    EXPECT_FALSE(ll.contains(Item{2}));
+}
+
+TEST(IntrusiveLinkedList, unlinkIsConstantTime) {
+    Item a{1}, b{2}, c{3};
+    IntrusiveLinkedList<Item> ll{};
+    ll.push_back(a);
+    ll.push_back(b);
+    ll.push_back(c);
+
+    ll.unlink(b);
+    EXPECT_FALSE(b.is_linked());
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 3 -> NULL]");
+
+    ll.unlink(c);
+    EXPECT_EQ(&ll.back()->get(), &a);
+
+    ll.unlink(a);
+    EXPECT_TRUE(ll.is_empty());
+
+    ll.push_back(b);
+    EXPECT_EQ(std::format("{}", ll), "[2 -> NULL]");
+}
+
+TEST(IntrusiveLinkedList, popAndErase) {
+    std::vector<Item> items{Item{1}, Item{2}, Item{3}, Item{4}};
+    IntrusiveLinkedList<Item> ll{};
+    for (auto& item : items) {
+        ll.push_back(item);
+    }
+
+    ll.pop_front();
+    ll.pop_back();
+    EXPECT_EQ(std::format("{}", ll), "[2 -> 3 -> NULL]");
+    EXPECT_FALSE(items[0].is_linked());
+    EXPECT_FALSE(items[3].is_linked());
+
+    auto it = ll.erase(ll.cbegin());
+    EXPECT_EQ(it->value, 3);
+    ll.insert(it, items[0]);
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 3 -> NULL]");
+}
+
+TEST(IntrusiveLinkedList, removeAndRemoveAll) {
+    Item a{1}, b{2}, c{1}, d{1};
+    IntrusiveLinkedList<Item> ll{};
+    ll.push_back(a);
+    ll.push_back(b);
+    ll.push_back(c);
+    ll.push_back(d);
+
+    ll.remove(Item{1});
+    EXPECT_FALSE(a.is_linked());
+    EXPECT_EQ(std::format("{}", ll), "[2 -> 1 -> 1 -> NULL]");
+
+    ll.remove_all(Item{1});
+    EXPECT_EQ(std::format("{}", ll), "[2 -> NULL]");
+    EXPECT_EQ(ll.size(), 1);
+    EXPECT_FALSE(d.is_linked());
+}
+
+TEST(IntrusiveLinkedList, iteratesBothWays) {
+    Item a{1}, b{2}, c{3};
+    IntrusiveLinkedList<Item> ll{};
+    ll.push_back(a);
+    ll.push_back(b);
+    ll.push_back(c);
+
+    static_assert(std::bidirectional_iterator<
+                      IntrusiveLinkedList<Item>::const_iterator>);
+
+    int sum{};
+    for (auto& item : ll) {
+        sum += item.value;
+    }
+    EXPECT_EQ(sum, 6);
+
+    auto it = ll.end();
+    EXPECT_EQ((--it)->value, 3);
+    EXPECT_EQ((--it)->value, 2);
+}
+
+TEST(IntrusiveLinkedList, memberHooksAllowSeveralLists) {
+    Task write{"write"}, read{"read"}, idle{"idle"};
+    ReadyList ready{};
+    AllList   all{};
+
+    all.push_back(write);
+    all.push_back(read);
+    all.push_back(idle);
+    ready.push_back(read);
+    ready.push_back(write);
+
+    EXPECT_EQ(all.size(), 3);
+    EXPECT_EQ(ready.front()->get().name, "read");
+    EXPECT_EQ(&ready.back()->get(), &write);
+
+    ready.unlink(read);
+    EXPECT_EQ(all.size(), 3);
+    EXPECT_TRUE(read.all_hook.is_linked());
+    EXPECT_FALSE(read.ready_hook.is_linked());
+    EXPECT_TRUE(all.contains(Task{"read"}));
+}
+
+TEST(IntrusiveLinkedList, memberHookInPolymorphicObject) {
+    Job a{1, "a"};
+    Job b{2, "b"};
+    IntrusiveLinkedList<Job, MemberHook<&Job::hook>> jobs{};
+    IntrusiveLinkedList<Item> items{};
+
+    jobs.push_back(a);
+    jobs.push_back(b);
+    items.push_back(b);
+
+    EXPECT_EQ(&jobs.front()->get(), &a);
+    EXPECT_EQ(&jobs.back()->get(), &b);
+    EXPECT_EQ(jobs.back()->get().owner, "b");
+    EXPECT_EQ(&items.front()->get(), &b);
+}
+
+TEST(IntrusiveLinkedList, memberHookOffsetMatchesObjectLayout) {
+    using JobHook    = detail::HookTraits<Job, MemberHook<&Job::hook>>;
+    using TaggedHook = detail::HookTraits<TaggedJob,
+                                          MemberHook<&TaggedJob::tagged_hook>>;
+    using ReadyHook  = detail::HookTraits<Task,
+                                          MemberHook<&Task::ready_hook>>;
+    using AllHook    = detail::HookTraits<Task, MemberHook<&Task::all_hook>>;
+
+    Job       job{1, "a"};
+    TaggedJob tagged{2, "b"};
+    Task      task{"c"};
+
+    EXPECT_EQ(&JobHook::from_hook(JobHook::to_hook(job)), &job);
+    EXPECT_EQ(&TaggedHook::from_hook(TaggedHook::to_hook(tagged)), &tagged);
+    EXPECT_EQ(&ReadyHook::from_hook(ReadyHook::to_hook(task)), &task);
+    EXPECT_EQ(&AllHook::from_hook(AllHook::to_hook(task)), &task);
+}
+
+TEST(IntrusiveLinkedList, destructionUnlinksObjects) {
+    Item a{1}, b{2};
+    {
+        IntrusiveLinkedList<Item> ll{};
+        ll.push_back(a);
+        ll.push_back(b);
+    }
+    EXPECT_FALSE(a.is_linked());
+    EXPECT_FALSE(b.is_linked());
+}
+
+TEST(IntrusiveLinkedList, moveTransfersObjects) {
+    Item a{1}, b{2};
+    IntrusiveLinkedList<Item> l1{};
+    l1.push_back(a);
+    l1.push_back(b);
+
+    IntrusiveLinkedList<Item> l2{std::move(l1)};
+    EXPECT_TRUE(l1.is_empty());
+    EXPECT_EQ(std::format("{}", l2), "[1 -> 2 -> NULL]");
+
+    l2.pop_back();
+    l1 = std::move(l2);
+    EXPECT_EQ(std::format("{}", l1), "[1 -> NULL]");
+    EXPECT_EQ(&l1.back()->get(), &a);
+}
+
+TEST(IntrusiveLinkedList, copiedObjectStartsUnlinked) {
+    Item a{1};
+    IntrusiveLinkedList<Item> ll{};
+    ll.push_back(a);
+
+    Item copy{a};
+    EXPECT_FALSE(copy.is_linked());
+
+    copy = a;
+    EXPECT_FALSE(copy.is_linked());
+    EXPECT_EQ(ll.size(), 1);
+}
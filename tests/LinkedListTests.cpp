@@ -1,10 +1,22 @@
 #include "LinkedList/LinkedList.hpp"
+#include "LinkedList/MemoryUsage.hpp"
 
 #include <gtest/gtest.h>
 
 #include <utility>
+#include <any>
 #include <format>
 #include <string>
+#include <memory_resource>
+#include <forward_list>
+#include <ranges>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <vector>
 
 TEST(LinkedList, canCreateEmptyLinkedList) {
     LinkedList<int> ll{};
@@ -412,6 +424,57 @@ TEST(LinkedList, shouldWorkWithOutputStream) {
     EXPECT_EQ(ss.str(), expected);
 }
 
+TEST(LinkedList, formatSpecsAreForwardedToElements) {
+    const LinkedList ll{10, 255};
+
+    EXPECT_EQ(std::format("{::#x}", ll), "[0xa -> 0xff -> NULL]");
+    EXPECT_EQ(std::format("{::>4}", ll), "[  10 ->  255 -> NULL]");
+    EXPECT_EQ(std::format("{:n}", ll), "10 -> 255 -> NULL");
+    EXPECT_EQ(std::format("{:n:x}", ll), "a -> ff -> NULL");
+    EXPECT_THROW((void)std::vformat("{:q}", std::make_format_args(ll)),
+                 std::format_error);
+}
+
+TEST(LinkedList, formatCanTruncate) {
+    const LinkedList<int> ll{std::from_range, std::views::iota(0, 1'000)};
+
+    EXPECT_EQ(std::format("{:.3}", ll), "[0 -> 1 -> 2 -> ...]");
+    EXPECT_EQ(std::format("{:n.2:02}", ll), "00 -> 01 -> ...");
+    EXPECT_EQ(std::format("{:.0}", ll), "[...]");
+    EXPECT_EQ(std::format("{:.3}", LinkedList{1, 2}), "[1 -> 2 -> NULL]");
+    EXPECT_EQ(std::format("{:.2}", LinkedList{1, 2}), "[1 -> 2 -> NULL]");
+    EXPECT_EQ(std::format("{:.0}", LinkedList<int>{}), "[NULL]");
+}
+
+namespace {
+
+struct CommaSeparated {
+    const LinkedList<int>& ll;
+};
+
+}
+
+template <>
+struct std::formatter<CommaSeparated> : LinkedListFormatter<int> {
+    constexpr formatter() {
+        set_separator(", ");
+        set_brackets("{", "}");
+        set_terminator("");
+    }
+
+    auto format(const CommaSeparated& list, std::format_context& ctx) const {
+        return LinkedListFormatter<int>::format(list.ll, ctx);
+    }
+};
+
+TEST(LinkedList, formatSeparatorsAndBracketsCanBeChanged) {
+    const LinkedList ll{1, 2, 3};
+
+    EXPECT_EQ(std::format("{}", CommaSeparated{ll}), "{1, 2, 3}");
+    EXPECT_EQ(std::format("{:.2}", CommaSeparated{ll}), "{1, 2, ...}");
+    EXPECT_EQ(std::format("{}", CommaSeparated{LinkedList<int>{}}), "{}");
+}
+
 TEST(LinkedList, defaultConstructorShouldBeConstexpr) {
     constexpr LinkedList<int> ll{};
 }
@@ -548,3 +611,1659 @@ TEST(LinkedList, removeAllWhenListHasSameElements) {
     EXPECT_EQ(ll.size(), 0);
 }
 
+
+TEST(LinkedList, backFollowsPushBackAndPushFront) {
+    LinkedList<int> ll{};
+
+    ll.push_front(1);
+    EXPECT_EQ(ll.back(), 1);
+
+    ll.push_back(2);
+    EXPECT_EQ(ll.back(), 2);
+
+    ll.push_front(0);
+    EXPECT_EQ(ll.back(), 2);
+}
+
+TEST(LinkedList, backFollowsPopBack) {
+    LinkedList ll{1, 2, 3};
+
+    ll.pop_back();
+    EXPECT_EQ(ll.back(), 2);
+    ll.pop_back();
+    EXPECT_EQ(ll.back(), 1);
+    ll.pop_back();
+    EXPECT_EQ(ll.back(), std::unexpected(LinkedListError::EmptyList));
+
+    ll.push_back(4);
+    EXPECT_EQ(ll.front(), 4);
+    EXPECT_EQ(ll.back(), 4);
+}
+
+TEST(LinkedList, backFollowsPopFrontOfLastElement) {
+    LinkedList ll{1};
+
+    ll.pop_front();
+    EXPECT_FALSE(ll.back().has_value());
+
+    ll.push_back(2);
+    EXPECT_EQ(ll.front(), 2);
+    EXPECT_EQ(ll.back(), 2);
+}
+
+TEST(LinkedList, backFollowsRemoveOfLastElement) {
+    LinkedList ll{1, 2, 3};
+
+    ll.remove(3);
+    EXPECT_EQ(ll.back(), 2);
+
+    ll.push_back(5);
+    EXPECT_EQ(ll.back(), 5);
+    EXPECT_EQ(ll.size(), 3);
+}
+
+TEST(LinkedList, removeOnlyElement) {
+    LinkedList ll{1};
+
+    ll.remove(1);
+
+    EXPECT_TRUE(ll.is_empty());
+    EXPECT_FALSE(ll.back().has_value());
+}
+
+TEST(LinkedList, backFollowsRemoveAll) {
+    LinkedList ll{1, 2, 1, 1};
+
+    ll.remove_all(1);
+    EXPECT_EQ(ll.back(), 2);
+
+    ll.remove_all(2);
+    EXPECT_FALSE(ll.back().has_value());
+
+    ll.push_back(3);
+    EXPECT_EQ(ll.front(), 3);
+    EXPECT_EQ(ll.back(), 3);
+}
+
+TEST(LinkedList, backFollowsCopyMoveAndSwap) {
+    LinkedList l1{1, 2};
+    LinkedList l2 = l1;
+    EXPECT_EQ(l2.back(), 2);
+
+    LinkedList l3{std::move(l1)};
+    EXPECT_EQ(l3.back(), 2);
+    EXPECT_FALSE(l1.back().has_value());
+
+    LinkedList l4{7, 8, 9};
+    swap(l3, l4);
+    EXPECT_EQ(l3.back(), 9);
+    EXPECT_EQ(l4.back(), 2);
+
+    l4.clear();
+    EXPECT_FALSE(l4.back().has_value());
+}
+
+TEST(LinkedList, pushBackMillionElementsInLinearTime) {
+    // With a quadratic push_back this would take hours, not milliseconds.
+    constexpr std::size_t count{1'000'000};
+    LinkedList<std::size_t> ll{};
+
+    for (std::size_t i{}; i < count; ++i) {
+        ll.push_back(i);
+        ASSERT_EQ(ll.back(), i);
+    }
+
+    EXPECT_EQ(ll.size(), count);
+    EXPECT_EQ(ll.front(), 0);
+}
+
+namespace {
+
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    std::size_t* allocations;
+    std::size_t* deallocations;
+
+    CountingAllocator(std::size_t* a, std::size_t* d)
+        : allocations{a}, deallocations{d} {}
+
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>& other)
+        : allocations{other.allocations}, deallocations{other.deallocations} {}
+
+    T* allocate(std::size_t n) {
+        ++(*allocations);
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) {
+        ++(*deallocations);
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    friend bool operator==(const CountingAllocator&,
+                           const CountingAllocator&) = default;
+};
+
+// Copies throw once `copies_left` runs out; moves may throw, so that
+// std::move_if_noexcept copies.
+struct ThrowingCopy {
+    static inline int copies_left{};
+
+    int value;
+
+    explicit ThrowingCopy(int v) : value{v} {}
+
+    ThrowingCopy(const ThrowingCopy& other) : value{other.value} {
+        if (copies_left-- == 0) throw std::runtime_error{"copy"};
+    }
+
+    ThrowingCopy(ThrowingCopy&& other) : value{other.value} {}
+};
+
+}
+
+TEST(LinkedList, nodesAreAllocatedWithGivenAllocator) {
+    std::size_t allocations{};
+    std::size_t deallocations{};
+    {
+        CountingAllocator<int> alloc{&allocations, &deallocations};
+        LinkedList<int, CountingAllocator<int>> ll{{1, 2}, alloc};
+        ll.push_back(3);
+        ll.push_front(0);
+        ll.pop_back();
+
+        LinkedList copy{ll};
+        EXPECT_EQ(copy, ll);
+        EXPECT_EQ(allocations, 7);
+        EXPECT_EQ(deallocations, 1);
+    }
+    EXPECT_EQ(allocations, 7);
+    EXPECT_EQ(deallocations, 7);
+}
+
+TEST(LinkedList, pmrListAllocatesFromMemoryResource) {
+    std::array<std::byte, 1024> buffer{};
+    std::pmr::monotonic_buffer_resource resource{
+        buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+
+    pmr::LinkedList<int> ll{&resource};
+    ll.push_back(1);
+    ll.push_back(2);
+    ll.push_front(0);
+
+    EXPECT_EQ(ll.get_allocator().resource(), &resource);
+    EXPECT_EQ(std::format("{}", ll), "[0 -> 1 -> 2 -> NULL]");
+}
+
+TEST(LinkedList, pmrCopyUsesDefaultResource) {
+    std::pmr::monotonic_buffer_resource resource{};
+    pmr::LinkedList<int> l1{{1, 2}, &resource};
+
+    pmr::LinkedList<int> l2{l1};
+
+    EXPECT_EQ(l2, l1);
+    EXPECT_EQ(l2.get_allocator().resource(), std::pmr::get_default_resource());
+}
+
+TEST(LinkedList, pmrMoveKeepsResource) {
+    std::pmr::monotonic_buffer_resource resource{};
+    pmr::LinkedList<int> l1{{1, 2}, &resource};
+
+    pmr::LinkedList<int> l2{std::move(l1)};
+
+    EXPECT_TRUE(l1.is_empty());
+    EXPECT_EQ(l2.size(), 2);
+    EXPECT_EQ(l2.back(), 2);
+    EXPECT_EQ(l2.get_allocator().resource(), &resource);
+}
+
+TEST(LinkedList, pmrMoveAssignmentBetweenResourcesMovesElements) {
+    std::pmr::monotonic_buffer_resource r1{};
+    std::pmr::monotonic_buffer_resource r2{};
+    pmr::LinkedList<std::pmr::string> l1{{"a", "b"}, &r1};
+    pmr::LinkedList<std::pmr::string> l2{&r2};
+
+    l2 = std::move(l1);
+
+    EXPECT_TRUE(l1.is_empty());
+    EXPECT_EQ(l2.size(), 2);
+    EXPECT_EQ(l2.front()->get(), "a");
+    EXPECT_EQ(l2.back()->get(), "b");
+    EXPECT_EQ(l2.get_allocator().resource(), &r2);
+}
+
+TEST(LinkedList, pmrCopyAssignmentKeepsResource) {
+    std::pmr::monotonic_buffer_resource r1{};
+    std::pmr::monotonic_buffer_resource r2{};
+    pmr::LinkedList<int> l1{{1, 2}, &r1};
+    pmr::LinkedList<int> l2{{3}, &r2};
+
+    l2 = l1;
+
+    EXPECT_EQ(l2, l1);
+    EXPECT_EQ(l2.get_allocator().resource(), &r2);
+}
+
+TEST(LinkedList, reserveAllocatesNodesInOneChunk) {
+    std::size_t allocations{};
+    std::size_t deallocations{};
+    {
+        CountingAllocator<int> alloc{&allocations, &deallocations};
+        LinkedList<int, CountingAllocator<int>> ll{alloc};
+
+        ll.reserve(100);
+        EXPECT_GE(ll.capacity(), 100);
+        const auto after_reserve = allocations;
+
+        for (int i{}; i < 100; ++i) {
+            ll.push_back(i);
+        }
+        EXPECT_EQ(allocations, after_reserve);
+        EXPECT_EQ(ll.size(), 100);
+        EXPECT_EQ(ll.back(), 99);
+    }
+    EXPECT_EQ(allocations, deallocations);
+}
+
+TEST(LinkedList, poppedNodesAreRecycled) {
+    std::size_t allocations{};
+    std::size_t deallocations{};
+    {
+        CountingAllocator<int> alloc{&allocations, &deallocations};
+        LinkedList<int, CountingAllocator<int>> ll{alloc};
+        ll.reserve(4);
+        const auto after_reserve = allocations;
+
+        for (int i{}; i < 10'000; ++i) {
+            ll.push_back(i);
+            ll.push_back(i + 1);
+            ll.pop_front();
+            ll.pop_front();
+        }
+        ll.push_front(1);
+        ll.remove(1);
+
+        EXPECT_TRUE(ll.is_empty());
+        EXPECT_EQ(allocations, after_reserve);
+        EXPECT_EQ(deallocations, 0);
+    }
+    EXPECT_EQ(allocations, deallocations);
+}
+
+TEST(LinkedList, reserveKeepsExistingElements) {
+    LinkedList<std::string> ll{"a", "b"};
+
+    ll.reserve(8);
+    ll.push_back("c");
+    ll.pop_front();
+    ll.push_front("d");
+
+    EXPECT_EQ(ll.size(), 3);
+    EXPECT_GE(ll.capacity(), 8);
+    EXPECT_EQ(std::format("{}", ll), "[d -> b -> c -> NULL]");
+}
+
+TEST(LinkedList, shrinkToFitReleasesSpareNodes) {
+    std::size_t allocations{};
+    std::size_t deallocations{};
+    {
+        CountingAllocator<int> alloc{&allocations, &deallocations};
+        LinkedList<int, CountingAllocator<int>> ll{{1, 2}, alloc};
+
+        ll.reserve(64);
+        for (int i{}; i < 40; ++i) {
+            ll.push_back(i);
+        }
+        ll.clear();
+        EXPECT_GE(ll.capacity(), 64);
+
+        ll.shrink_to_fit();
+        EXPECT_EQ(ll.capacity(), 0);
+        EXPECT_EQ(allocations, deallocations);
+
+        ll.push_back(5);
+        EXPECT_EQ(ll.front(), 5);
+    }
+    EXPECT_EQ(allocations, deallocations);
+}
+
+TEST(LinkedList, shrinkToFitKeepsChunksInUse) {
+    LinkedList<int> ll{};
+    ll.reserve(16);
+    for (int i{}; i < 16; ++i) {
+        ll.push_back(i);
+    }
+    ll.pop_front();
+
+    ll.shrink_to_fit();
+
+    EXPECT_EQ(ll.size(), 15);
+    EXPECT_EQ(ll.front(), 1);
+    EXPECT_EQ(ll.back(), 15);
+}
+
+TEST(LinkedList, reservedListCanBeMovedAndSwapped) {
+    LinkedList<int> l1{};
+    l1.reserve(16);
+    l1.push_back(1);
+    l1.push_back(2);
+
+    LinkedList<int> l2{std::move(l1)};
+    EXPECT_EQ(l2.size(), 2);
+
+    LinkedList<int> l3{3};
+    swap(l2, l3);
+    l3.pop_front();
+    l3.push_back(4);
+    EXPECT_EQ(std::format("{}", l3), "[2 -> 4 -> NULL]");
+
+    l1 = std::move(l3);
+    EXPECT_EQ(std::format("{}", l1), "[2 -> 4 -> NULL]");
+    EXPECT_EQ(l2.front(), 3);
+}
+
+namespace {
+
+struct Message {
+    static inline unsigned copies{};
+    static inline unsigned moves{};
+
+    std::string topic;
+    int         id{};
+
+    Message(std::string topic, int id) : topic{std::move(topic)}, id{id} {}
+
+    Message(const Message& other) : topic{other.topic}, id{other.id} {
+        ++copies;
+    }
+
+    Message(Message&& other) noexcept
+        : topic{std::move(other.topic)}, id{other.id} {
+        ++moves;
+    }
+
+    Message& operator=(const Message&) = delete;
+    Message& operator=(Message&&)      = delete;
+};
+
+}
+
+TEST(LinkedList, emplaceConstructsElementsInPlace) {
+    Message::copies = 0;
+    Message::moves  = 0;
+
+    LinkedList<Message> ll{};
+    auto& back  = ll.emplace_back("b", 2);
+    auto& front = ll.emplace_front("a", 1);
+    ll.emplace_back("c", 3);
+
+    EXPECT_EQ(Message::copies, 0);
+    EXPECT_EQ(Message::moves, 0);
+
+    EXPECT_EQ(front.id, 1);
+    EXPECT_EQ(back.id, 2);
+    EXPECT_EQ(ll.size(), 3);
+    EXPECT_EQ(ll.front()->get().topic, "a");
+    EXPECT_EQ(ll.back()->get().topic, "c");
+}
+
+TEST(LinkedList, emplaceAfter) {
+    LinkedList ll{1, 3};
+
+    auto it = ll.emplace_after(ll.begin(), 2);
+    EXPECT_EQ(*it, 2);
+
+    it = ll.emplace_after(++it, 4);
+    EXPECT_EQ(*it, 4);
+    EXPECT_EQ(ll.back(), 4);
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 2 -> 3 -> 4 -> NULL]");
+
+    LinkedList<int>::const_iterator last = it;
+    ll.emplace_after(last, 5);
+    EXPECT_EQ(ll.back(), 5);
+    EXPECT_EQ(ll.size(), 5);
+
+    ll.push_back(6);
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 2 -> 3 -> 4 -> 5 -> 6 -> NULL]");
+}
+
+TEST(LinkedList, sort) {
+    LinkedList ll{5, 3, 9, 1, 3, 7, 2};
+
+    ll.sort();
+
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 2 -> 3 -> 3 -> 5 -> 7 -> 9 -> NULL]");
+    EXPECT_EQ(ll.size(), 7);
+    EXPECT_EQ(ll.back(), 9);
+
+    ll.push_back(10);
+    EXPECT_EQ(ll.back(), 10);
+}
+
+TEST(LinkedList, sortWithComparator) {
+    LinkedList ll{5, 3, 9, 1};
+
+    ll.sort(std::greater<>{});
+
+    EXPECT_EQ(std::format("{}", ll), "[9 -> 5 -> 3 -> 1 -> NULL]");
+    EXPECT_EQ(ll.back(), 1);
+}
+
+TEST(LinkedList, sortIsStable) {
+    LinkedList<std::pair<int, int>> ll{};
+    for (int i{}; i < 1000; ++i) {
+        ll.emplace_back((i * 7919) % 10, i);
+    }
+
+    ll.sort([](const auto& lhs, const auto& rhs) {
+        return lhs.first < rhs.first;
+    });
+
+    auto previous = *ll.begin();
+    for (const auto& element : ll) {
+        ASSERT_LE(previous.first, element.first);
+        if (previous.first == element.first) {
+            ASSERT_LE(previous.second, element.second);
+        }
+        previous = element;
+    }
+    EXPECT_EQ(ll.size(), 1000);
+}
+
+TEST(LinkedList, sortDoesNotAllocate) {
+    std::size_t allocations{};
+    std::size_t deallocations{};
+    CountingAllocator<int> alloc{&allocations, &deallocations};
+    LinkedList<int, CountingAllocator<int>> ll{{4, 2, 8, 6}, alloc};
+
+    ll.sort();
+
+    EXPECT_EQ(allocations, 4);
+    EXPECT_EQ(deallocations, 0);
+    EXPECT_EQ(std::format("{}", ll), "[2 -> 4 -> 6 -> 8 -> NULL]");
+}
+
+TEST(LinkedList, sortEmptyAndSingleElementList) {
+    LinkedList<int> l1{};
+    l1.sort();
+    EXPECT_TRUE(l1.is_empty());
+
+    LinkedList l2{1};
+    l2.sort();
+    EXPECT_EQ(l2.front(), 1);
+    EXPECT_EQ(l2.back(), 1);
+}
+
+TEST(LinkedList, merge) {
+    LinkedList l1{1, 3, 5, 7};
+    LinkedList l2{2, 3, 4, 8, 9};
+
+    l1.merge(std::move(l2));
+
+    EXPECT_TRUE(l2.is_empty());
+    EXPECT_EQ(l1.size(), 9);
+    EXPECT_EQ(l1.back(), 9);
+    EXPECT_EQ(std::format("{}", l1),
+        "[1 -> 2 -> 3 -> 3 -> 4 -> 5 -> 7 -> 8 -> 9 -> NULL]");
+
+    LinkedList<int> empty{};
+    l1.merge(std::move(empty));
+    EXPECT_EQ(l1.size(), 9);
+
+    empty.merge(std::move(l1));
+    EXPECT_EQ(empty.size(), 9);
+    EXPECT_EQ(empty.back(), 9);
+}
+
+TEST(LinkedList, mergeKeepsElementsOfThisListFirst) {
+    using Element = std::pair<int, char>;
+    LinkedList<Element> l1{{1, 'a'}, {2, 'a'}};
+    LinkedList<Element> l2{{1, 'b'}, {2, 'b'}};
+
+    const auto by_key = [](const Element& lhs, const Element& rhs) {
+        return lhs.first < rhs.first;
+    };
+    l1.merge(std::move(l2), by_key);
+
+    std::string order;
+    for (const auto& [key, tag] : l1) {
+        order += tag;
+    }
+    EXPECT_EQ(order, "abab");
+    EXPECT_EQ(l1.back()->get().second, 'b');
+}
+
+TEST(LinkedList, mergeFromReservedList) {
+    LinkedList<int> l1{1, 4};
+    LinkedList<int> l2{};
+    l2.reserve(8);
+    l2.push_back(2);
+    l2.push_back(3);
+
+    l1.merge(std::move(l2));
+
+    EXPECT_EQ(std::format("{}", l1), "[1 -> 2 -> 3 -> 4 -> NULL]");
+    EXPECT_TRUE(l2.is_empty());
+}
+
+TEST(LinkedList, unique) {
+    LinkedList ll{1, 1, 2, 3, 3, 3, 1, 4, 4};
+
+    EXPECT_EQ(ll.unique(), 4);
+
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 2 -> 3 -> 1 -> 4 -> NULL]");
+    EXPECT_EQ(ll.size(), 5);
+    EXPECT_EQ(ll.back(), 4);
+
+    ll.push_back(5);
+    EXPECT_EQ(ll.back(), 5);
+}
+
+TEST(LinkedList, uniqueWithPredicate) {
+    LinkedList ll{1, 2, 4, 5, 9};
+
+    EXPECT_EQ(ll.unique([](int a, int b) { return b - a == 1; }), 2);
+
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 4 -> 9 -> NULL]");
+    EXPECT_EQ(LinkedList<int>{}.unique(), 0);
+}
+
+TEST(LinkedList, spliceAfterWholeList) {
+    LinkedList l1{1, 4};
+    LinkedList l2{2, 3};
+
+    l1.splice_after(l1.begin(), l2);
+
+    EXPECT_TRUE(l2.is_empty());
+    EXPECT_FALSE(l2.back().has_value());
+    EXPECT_EQ(l1.size(), 4);
+    EXPECT_EQ(std::format("{}", l1), "[1 -> 2 -> 3 -> 4 -> NULL]");
+    EXPECT_EQ(l1.back(), 4);
+
+    LinkedList l3{5};
+    auto last = l1.begin();
+    for (std::size_t i{1}; i < l1.size(); ++i) ++last;
+    l1.splice_after(last, std::move(l3));
+    EXPECT_EQ(l1.back(), 5);
+    EXPECT_EQ(l1.size(), 5);
+}
+
+TEST(LinkedList, spliceAfterDoesNotAllocate) {
+    std::size_t allocations{};
+    std::size_t deallocations{};
+    CountingAllocator<int> alloc{&allocations, &deallocations};
+    {
+        LinkedList<int, CountingAllocator<int>> l1{{1, 2}, alloc};
+        LinkedList<int, CountingAllocator<int>> l2{{3, 4}, alloc};
+
+        l1.append(std::move(l2));
+        l2.push_back(5);
+        l1.splice_after(l1.begin(), l2);
+
+        EXPECT_EQ(allocations, 5);
+        EXPECT_EQ(deallocations, 0);
+        EXPECT_EQ(std::format("{}", l1), "[1 -> 5 -> 2 -> 3 -> 4 -> NULL]");
+    }
+    EXPECT_EQ(deallocations, 5);
+}
+
+TEST(LinkedList, spliceAfterRange) {
+    LinkedList l1{1, 5};
+    LinkedList l2{0, 2, 3, 4, 9};
+
+    auto before = l2.cbegin();
+    auto last   = before;
+    for (int i{}; i < 4; ++i) ++last;
+
+    l1.splice_after(l1.begin(), l2, before, last);
+
+    EXPECT_EQ(std::format("{}", l1), "[1 -> 2 -> 3 -> 4 -> 5 -> NULL]");
+    EXPECT_EQ(std::format("{}", l2), "[0 -> 9 -> NULL]");
+    EXPECT_EQ(l1.size(), 5);
+    EXPECT_EQ(l2.size(), 2);
+}
+
+TEST(LinkedList, spliceAfterRangeUpdatesTails) {
+    LinkedList l1{1};
+    LinkedList l2{0, 2, 3};
+
+    l1.splice_after(l1.begin(), l2, l2.cbegin(), l2.cend());
+
+    EXPECT_EQ(l1.back(), 3);
+    EXPECT_EQ(l2.back(), 0);
+    EXPECT_EQ(l2.size(), 1);
+
+    l2.push_back(7);
+    l1.push_back(8);
+    EXPECT_EQ(std::format("{}", l1), "[1 -> 2 -> 3 -> 8 -> NULL]");
+    EXPECT_EQ(std::format("{}", l2), "[0 -> 7 -> NULL]");
+}
+
+TEST(LinkedList, spliceAfterRangeWithinList) {
+    LinkedList ll{1, 2, 3, 4};
+
+    // Move (1, 3) = {2} behind 4.
+    auto last = ll.cbegin();
+    ++last;
+    ++last;
+    auto pos = last;
+    ++pos;
+    ll.splice_after(pos, ll, ll.cbegin(), last);
+
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 3 -> 4 -> 2 -> NULL]");
+    EXPECT_EQ(ll.size(), 4);
+    EXPECT_EQ(ll.back(), 2);
+}
+
+TEST(LinkedList, spliceFromReservedListMovesElements) {
+    LinkedList l1{1, 4};
+    LinkedList<int> l2{};
+    l2.reserve(4);
+    l2.push_back(2);
+    l2.push_back(3);
+
+    l1.splice_after(l1.begin(), l2);
+    l2.shrink_to_fit();
+
+    EXPECT_EQ(std::format("{}", l1), "[1 -> 2 -> 3 -> 4 -> NULL]");
+    EXPECT_TRUE(l2.is_empty());
+}
+
+TEST(LinkedList, append) {
+    LinkedList<int> l1{};
+    LinkedList l2{1, 2};
+    LinkedList l3{3};
+
+    l1.append(std::move(l2));
+    l1.append(std::move(l3));
+    l1.append(LinkedList<int>{});
+
+    EXPECT_EQ(std::format("{}", l1), "[1 -> 2 -> 3 -> NULL]");
+    EXPECT_EQ(l1.size(), 3);
+    EXPECT_EQ(l1.back(), 3);
+    EXPECT_TRUE(l2.is_empty());
+    EXPECT_TRUE(l3.is_empty());
+}
+
+TEST(LinkedList, splitAfter) {
+    LinkedList ll{1, 2, 3, 4, 5};
+
+    auto pos = ll.cbegin();
+    ++pos;
+    auto tail = ll.split_after(pos);
+
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 2 -> NULL]");
+    EXPECT_EQ(std::format("{}", tail), "[3 -> 4 -> 5 -> NULL]");
+    EXPECT_EQ(ll.size(), 2);
+    EXPECT_EQ(tail.size(), 3);
+    EXPECT_EQ(ll.back(), 2);
+    EXPECT_EQ(tail.back(), 5);
+
+    auto nothing = tail.split_after(++++tail.cbegin());
+    EXPECT_TRUE(nothing.is_empty());
+    EXPECT_EQ(tail.size(), 3);
+
+    ll.append(std::move(tail));
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 2 -> 3 -> 4 -> 5 -> NULL]");
+}
+
+TEST(LinkedList, splitAfterOfReservedList) {
+    LinkedList<int> ll{};
+    ll.reserve(8);
+    for (int i{}; i < 4; ++i) {
+        ll.push_back(i);
+    }
+
+    auto tail = ll.split_after(ll.cbegin());
+
+    EXPECT_EQ(std::format("{}", ll), "[0 -> NULL]");
+    EXPECT_EQ(std::format("{}", tail), "[1 -> 2 -> 3 -> NULL]");
+}
+
+TEST(LinkedList, splitAfterOfElementsConstructibleFromAllocator) {
+    // std::any can hold the allocator, so braces would pick the
+    // initializer_list constructor for the new list.
+    LinkedList<std::any> ll{};
+    ll.push_back(1);
+
+    auto tail = ll.split_after(ll.cbegin());
+
+    EXPECT_TRUE(tail.is_empty());
+    EXPECT_EQ(ll.size(), 1);
+}
+
+TEST(LinkedList, iteratorIsForwardIterator) {
+    static_assert(std::forward_iterator<LinkedList<int>::iterator>);
+    static_assert(std::forward_iterator<LinkedList<int>::const_iterator>);
+    static_assert(std::ranges::forward_range<LinkedList<int>>);
+
+    LinkedList ll{1, 2};
+    auto it = ll.begin();
+    EXPECT_EQ(*it++, 1);
+    EXPECT_EQ(*it, 2);
+}
+
+TEST(LinkedList, prefetchTraversalBehavesLikeSequential) {
+    LinkedList<int, std::allocator<int>, PrefetchTraversal<2>> ll{};
+    for (int i{}; i < 10; ++i) {
+        ll.push_back(i % 3);
+    }
+
+    EXPECT_TRUE(ll.contains(2));
+    EXPECT_FALSE(ll.contains(3));
+
+    auto copy = ll;
+    EXPECT_EQ(copy, ll);
+    EXPECT_EQ(copy.back(), 0);
+
+    ll.remove_all(0);
+    EXPECT_EQ(std::format("{}", ll),
+              "[1 -> 2 -> 1 -> 2 -> 1 -> 2 -> NULL]");
+    EXPECT_EQ(ll.size(), 6);
+    EXPECT_EQ(ll.back(), 2);
+
+    ll.clear();
+    EXPECT_TRUE(ll.is_empty());
+
+    LinkedList<int, std::allocator<int>, PrefetchTraversal<8>> shorter{1};
+    EXPECT_TRUE(shorter.contains(1));
+    shorter.remove_all(1);
+    EXPECT_TRUE(shorter.is_empty());
+}
+
+TEST(LinkedList, prefetchedVisitsEveryElement) {
+    LinkedList ll{1, 2, 3, 4, 5};
+
+    int sum{};
+    for (auto& element : prefetched<2>(ll)) {
+        sum += element;
+        element = 0;
+    }
+    EXPECT_EQ(sum, 15);
+    EXPECT_FALSE(ll.contains(3));
+
+    const LinkedList<int> empty{};
+    auto view = prefetched(empty);
+    EXPECT_EQ(view.begin(), view.end());
+}
+
+TEST(LinkedList, constructFromIteratorPair) {
+    const std::vector<int> values{1, 2, 3};
+
+    LinkedList ll(values.begin(), values.end());
+
+    static_assert(std::is_same_v<decltype(ll), LinkedList<int>>);
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 2 -> 3 -> NULL]");
+    EXPECT_EQ(ll.size(), 3);
+    EXPECT_EQ(ll.back(), 3);
+}
+
+TEST(LinkedList, constructFromRange) {
+    LinkedList ll(std::from_range, std::views::iota(0, 5));
+
+    static_assert(std::is_same_v<decltype(ll), LinkedList<int>>);
+    EXPECT_EQ(std::format("{}", ll), "[0 -> 1 -> 2 -> 3 -> 4 -> NULL]");
+    EXPECT_EQ(ll.size(), 5);
+
+    LinkedList<std::string> strings(std::from_range,
+                                    std::vector<const char*>{"a", "b"});
+    EXPECT_EQ(std::format("{}", strings), "[a -> b -> NULL]");
+
+    LinkedList<int> empty(std::from_range, std::vector<int>{});
+    EXPECT_TRUE(empty.is_empty());
+}
+
+TEST(LinkedList, constructFromInputRange) {
+    std::istringstream input{"4 5 6"};
+
+    LinkedList<int> ll(std::from_range, std::views::istream<int>(input));
+
+    EXPECT_EQ(std::format("{}", ll), "[4 -> 5 -> 6 -> NULL]");
+    EXPECT_EQ(ll.size(), 3);
+}
+
+TEST(LinkedList, rangeConstructedListIsRelinkedWithoutAllocating) {
+    std::size_t allocations{};
+    std::size_t deallocations{};
+    {
+        CountingAllocator<int> alloc{&allocations, &deallocations};
+        using List = LinkedList<int, CountingAllocator<int>>;
+        List l1(std::from_range, std::views::iota(0, 100), alloc);
+        List l2(std::from_range, std::views::iota(100, 200), alloc);
+        List l3(std::from_range, std::views::iota(200, 300), alloc);
+        EXPECT_EQ(allocations, 300);
+
+        l1.merge(std::move(l3));
+        l1.splice_after(l1.begin(), l2);
+        l1.append(l1.split_after(l1.begin()));
+        EXPECT_EQ(allocations, 300);
+        EXPECT_EQ(deallocations, 0);
+        EXPECT_EQ(l1.size(), 300);
+
+        // Nodes still go back to the allocator one by one.
+        l1.pop_front();
+        l1.remove(150);
+        EXPECT_EQ(deallocations, 2);
+    }
+    EXPECT_EQ(allocations, deallocations);
+}
+
+TEST(LinkedList, rangeAppendedAfterReserveIsAllocatedInOneBlock) {
+    std::size_t allocations{};
+    std::size_t deallocations{};
+    {
+        CountingAllocator<int> alloc{&allocations, &deallocations};
+        LinkedList<int, CountingAllocator<int>> ll{alloc};
+        ll.reserve(0);
+        ll.append_range(std::views::iota(0, 1000));
+
+        // The block of nodes and the record describing it.
+        EXPECT_EQ(allocations, 2);
+        EXPECT_EQ(ll.size(), 1000);
+
+        // Nodes are laid out in list order.
+        const int* previous{nullptr};
+        for (const auto& element : ll) {
+            if (previous) {
+                EXPECT_LT(reinterpret_cast<std::uintptr_t>(previous),
+                          reinterpret_cast<std::uintptr_t>(&element));
+            }
+            previous = &element;
+        }
+    }
+    EXPECT_EQ(allocations, deallocations);
+}
+
+TEST(LinkedList, appendRange) {
+    LinkedList<int> ll{};
+
+    ll.append_range(std::vector{1, 2});
+    ll.append_range(std::forward_list{3, 4});
+    ll.append_range(std::vector<int>{});
+
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 2 -> 3 -> 4 -> NULL]");
+    EXPECT_EQ(ll.size(), 4);
+    EXPECT_EQ(ll.back(), 4);
+
+    ll.push_back(5);
+    EXPECT_EQ(ll.back(), 5);
+}
+
+TEST(LinkedList, prependRange) {
+    LinkedList<int> ll{};
+
+    ll.prepend_range(std::vector{3, 4});
+    ll.prepend_range(std::vector{1, 2});
+
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 2 -> 3 -> 4 -> NULL]");
+    EXPECT_EQ(ll.size(), 4);
+    EXPECT_EQ(ll.back(), 4);
+}
+
+TEST(LinkedList, appendRangeMovesFromRvalueRange) {
+    std::vector<Message> messages;
+    messages.emplace_back("a", 1);
+    messages.emplace_back("b", 2);
+    messages.emplace_back("c", 3);
+    Message::copies = 0;
+
+    LinkedList<Message> ll{};
+    ll.append_range(std::ranges::subrange(
+        std::make_move_iterator(messages.begin()),
+        std::make_move_iterator(messages.end())));
+
+    EXPECT_EQ(ll.size(), 3);
+    EXPECT_EQ(Message::copies, 0);
+}
+
+TEST(LinkedList, failedRangeConstructionFreesEverything) {
+    struct Throwing {
+        int value;
+        explicit Throwing(int v) : value{v} {
+            if (v == 3) throw std::runtime_error{"3"};
+        }
+    };
+
+    std::size_t allocations{};
+    std::size_t deallocations{};
+    CountingAllocator<Throwing> alloc{&allocations, &deallocations};
+
+    using List = LinkedList<Throwing, CountingAllocator<Throwing>>;
+    EXPECT_THROW(List(std::from_range, std::views::iota(0, 5), alloc),
+                 std::runtime_error);
+    EXPECT_EQ(allocations, deallocations);
+}
+
+TEST(LinkedList, relinearizeLaysNodesOutInListOrder) {
+    std::size_t allocations{};
+    std::size_t deallocations{};
+    {
+        CountingAllocator<int> alloc{&allocations, &deallocations};
+        LinkedList<int, CountingAllocator<int>> ll{alloc};
+        for (int i{}; i < 100; ++i) {
+            if (i % 2 == 0) {
+                ll.push_front(i);
+            } else {
+                ll.push_back(i);
+            }
+        }
+        const auto expected = std::format("{}", ll);
+
+        ll.relinearize();
+
+        EXPECT_EQ(std::format("{}", ll), expected);
+        EXPECT_EQ(ll.size(), 100);
+        EXPECT_EQ(ll.back(), 99);
+        EXPECT_EQ(ll.capacity(), 100);
+        EXPECT_EQ(allocations - deallocations, 2);
+
+        const int* previous{nullptr};
+        for (const auto& element : ll) {
+            if (previous) {
+                EXPECT_LT(reinterpret_cast<std::uintptr_t>(previous),
+                          reinterpret_cast<std::uintptr_t>(&element));
+            }
+            previous = &element;
+        }
+
+        ll.push_back(100);
+        EXPECT_EQ(ll.back(), 100);
+    }
+    EXPECT_EQ(allocations, deallocations);
+}
+
+TEST(LinkedList, relinearizeMoveOnlyElements) {
+    LinkedList<std::unique_ptr<int>> ll{};
+    for (int i{}; i < 10; ++i) {
+        ll.emplace_front(std::make_unique<int>(i));
+    }
+    ll.reserve(32);
+
+    ll.relinearize();
+
+    int expected{9};
+    for (const auto& element : ll) {
+        ASSERT_TRUE(element);
+        EXPECT_EQ(*element, expected--);
+    }
+    EXPECT_EQ(ll.size(), 10);
+
+    LinkedList<std::unique_ptr<int>> empty{};
+    empty.relinearize();
+    EXPECT_TRUE(empty.is_empty());
+}
+
+TEST(LinkedList, relinearizedListIsRelinkedAndFreedNodeByNode) {
+    std::size_t allocations{};
+    std::size_t deallocations{};
+    {
+        CountingAllocator<int> alloc{&allocations, &deallocations};
+        using List = LinkedList<int, CountingAllocator<int>>;
+        List l1{{0, 2, 4}, alloc};
+        List l2{{1, 3, 5}, alloc};
+        l1.relinearize();
+        l2.relinearize();
+        EXPECT_EQ(l1.capacity(), 3);
+
+        const auto relinearized = allocations;
+        List all{alloc};
+        all.append(std::move(l1));
+        all.merge(std::move(l2));
+        all.push_back(6);
+        EXPECT_EQ(allocations, relinearized + 1);
+        EXPECT_EQ(std::format("{}", all),
+                  "[0 -> 1 -> 2 -> 3 -> 4 -> 5 -> 6 -> NULL]");
+
+        // Each block goes back to the allocator with its last node.
+        while (!all.is_empty()) all.pop_front();
+        EXPECT_EQ(allocations, deallocations);
+    }
+    EXPECT_EQ(allocations, deallocations);
+}
+
+TEST(LinkedList, failedRelinearizeLeavesListUnchanged) {
+    std::size_t allocations{};
+    std::size_t deallocations{};
+    CountingAllocator<ThrowingCopy> alloc{&allocations, &deallocations};
+    LinkedList<ThrowingCopy, CountingAllocator<ThrowingCopy>> ll{alloc};
+    for (int i{}; i < 5; ++i) ll.emplace_back(i);
+
+    ThrowingCopy::copies_left = 3;
+    EXPECT_THROW(ll.relinearize(), std::runtime_error);
+    EXPECT_EQ(allocations - deallocations, 5);
+
+    ThrowingCopy::copies_left = 5;
+    ll.relinearize();
+
+    int expected{};
+    for (const auto& element : ll) EXPECT_EQ(element.value, expected++);
+    EXPECT_EQ(expected, 5);
+}
+
+TEST(LinkedList, modifiersAreConstexpr) {
+    constexpr auto result = [] {
+        LinkedList<int> ll{};
+        ll.push_back(2);
+        ll.push_front(1);
+        ll.emplace_back(3);
+        ll.emplace_after(ll.begin(), 4);
+        ll.remove(2);
+        ll.pop_back();
+        ll.remove_all(4);
+        ll.pop_front();
+        ll.push_back(5);
+        return ll.size() * 10 + *ll.begin();
+    }();
+
+    static_assert(result == 15);
+}
+
+namespace {
+
+template <typename T>
+using CountingList = LinkedList<T, std::allocator<T>, SequentialTraversal,
+                                CountingStats>;
+
+}
+
+TEST(LinkedList, noStatsTakesNoSpace) {
+    static_assert(std::is_empty_v<NoStats>);
+    static_assert(sizeof(LinkedList<int>) < sizeof(CountingList<int>));
+}
+
+TEST(LinkedList, statsCountNodesAndPeakSize) {
+    CountingList<int> ll{1, 2, 3};
+    ll.push_back(4);
+    ll.pop_front();
+    ll.remove_all(3);
+
+    const auto& stats = ll.stats();
+    EXPECT_EQ(stats.allocations(), 4);
+    EXPECT_EQ(stats.frees(), 2);
+    EXPECT_EQ(stats.peak_size(), 4);
+    EXPECT_EQ(stats.operation(LinkedListOp::RemoveAll).calls, 1);
+    EXPECT_EQ(stats.operation(LinkedListOp::RemoveAll).nodes_visited, 3);
+}
+
+TEST(LinkedList, statsCountVisitedNodes) {
+    CountingList<int> ll{1, 2, 3, 4, 5};
+
+    EXPECT_TRUE(ll.contains(2));
+    EXPECT_FALSE(ll.contains(7));
+    ll.remove(4);
+    ll.pop_back();
+    EXPECT_EQ(ll.back(), 3);
+
+    const auto& stats = ll.stats();
+    const auto& contains = stats.operation(LinkedListOp::Contains);
+    EXPECT_EQ(contains.calls, 2);
+    EXPECT_EQ(contains.nodes_visited, 7);
+    EXPECT_EQ(contains.max_nodes_visited, 5);
+    EXPECT_EQ(stats.operation(LinkedListOp::Remove).nodes_visited, 4);
+    EXPECT_EQ(stats.operation(LinkedListOp::PopBack).nodes_visited, 4);
+    EXPECT_EQ(stats.operation(LinkedListOp::GetLast).nodes_visited, 1);
+
+    const auto copy = ll;
+    EXPECT_EQ(copy.stats().operation(LinkedListOp::Copy).nodes_visited, 3);
+    EXPECT_EQ(copy.stats().allocations(), 3);
+}
+
+TEST(LinkedList, statsCanBeDumpedAndReset) {
+    CountingList<int> ll{1, 2};
+    ll.pop_back();
+
+    std::ostringstream os;
+    os << ll.stats();
+    EXPECT_EQ(os.str(), "allocations: 2\nfrees: 1\npeak_size: 2\n"
+                        "pop_back: calls 1, nodes visited 2, max 2");
+
+    ll.reset_stats();
+    EXPECT_EQ(ll.stats().allocations(), 0);
+    EXPECT_EQ(ll.stats().peak_size(), 0);
+    EXPECT_EQ(ll.stats().operation(LinkedListOp::PopBack).calls, 0);
+}
+
+TEST(LinkedList, memoryUsageCountsNodesAndSpareNodes) {
+    LinkedList<std::int64_t> ll{};
+    const auto empty = ll.memory_usage();
+    EXPECT_EQ(empty, sizeof(ll));
+
+    ll.push_back(1);
+    ll.push_back(2);
+    const auto node_bytes = (ll.memory_usage() - empty) / 2;
+    EXPECT_GE(node_bytes, sizeof(std::int64_t) + sizeof(void*));
+
+    ll.reserve(100);
+    EXPECT_GE(ll.memory_usage(), empty + 100 * node_bytes);
+    ll.clear();
+    EXPECT_GE(ll.memory_usage(), empty + 100 * node_bytes);
+    ll.shrink_to_fit();
+    EXPECT_EQ(ll.memory_usage(), empty);
+}
+
+TEST(LinkedList, memoryUsageWithElementBytes) {
+    LinkedList<std::string> ll{std::string(100, 'a'), "b"};
+
+    const auto deep = ll.memory_usage(
+        [](const std::string& s) { return s.capacity(); });
+
+    EXPECT_GE(deep, ll.memory_usage() + 100);
+}
+
+TEST(LinkedList, memoryUsageMatchesCountingResource) {
+    ByteCountingResource resource;
+    {
+        pmr::LinkedList<int> ll{&resource};
+        for (int i{}; i < 10; ++i) {
+            ll.push_back(i);
+        }
+        EXPECT_EQ(resource.allocations(), 10);
+        EXPECT_EQ(ll.memory_usage(), sizeof(ll) + resource.bytes_in_use());
+
+        ll.reserve(20);
+        EXPECT_EQ(ll.memory_usage(), sizeof(ll) + resource.bytes_in_use());
+    }
+    EXPECT_EQ(resource.bytes_in_use(), 0);
+    EXPECT_GT(resource.peak_bytes(), 0);
+
+    resource.reset_peak();
+    EXPECT_EQ(resource.peak_bytes(), 0);
+}
+
+TEST(LinkedList, positionalAccessWithoutIndex) {
+    LinkedList<int> ll{10, 20, 30};
+
+    EXPECT_EQ(ll.at(0), 10);
+    EXPECT_EQ(ll.at(2), 30);
+    EXPECT_EQ(ll.at(3), std::unexpected(LinkedListError::OutOfRange));
+    EXPECT_EQ(*ll.iterator_at(1), 20);
+    EXPECT_EQ(ll.iterator_at(3), ll.end());
+
+    EXPECT_EQ(**ll.insert_at(1, 15), 15);
+    EXPECT_EQ(**ll.insert_at(4, 40), 40);
+    EXPECT_EQ(ll.insert_at(6, 0).error(), LinkedListError::OutOfRange);
+    EXPECT_EQ(std::format("{}", ll), "[10 -> 15 -> 20 -> 30 -> 40 -> NULL]");
+
+    EXPECT_EQ(**ll.erase_at(2), 30);
+    EXPECT_EQ(*ll.erase_at(3), ll.end());
+    EXPECT_EQ(ll.erase_at(3).error(), LinkedListError::OutOfRange);
+    EXPECT_EQ(std::format("{}", ll), "[10 -> 15 -> 30 -> NULL]");
+    EXPECT_EQ(ll.back(), 30);
+}
+
+TEST(LinkedList, indexedListMatchesVectorUnderMixedOperations) {
+    IndexedLinkedList<int> ll{};
+    std::vector<int> expected;
+    std::mt19937 generator{7};
+
+    for (int step{}; step < 20'000; ++step) {
+        const auto size = expected.size();
+        const auto position = size ? generator() % (size + 1) : 0;
+        switch (generator() % 8) {
+            case 0: ll.push_front(step);
+                    expected.insert(expected.begin(), step); break;
+            case 1: ll.push_back(step); expected.push_back(step); break;
+            case 2: if (size) { ll.pop_front();
+                                expected.erase(expected.begin()); } break;
+            case 3: if (size) { ll.pop_back(); expected.pop_back(); } break;
+            case 4: ASSERT_TRUE(ll.insert_at(position, step));
+                    expected.insert(expected.begin() + position, step); break;
+            case 5: if (position < size) {
+                        ASSERT_TRUE(ll.erase_at(position));
+                        expected.erase(expected.begin() + position);
+                    } break;
+            case 6: if (position < size) {
+                        const auto value = expected[position];
+                        ll.remove(value);
+                        expected.erase(std::ranges::find(expected, value));
+                    } break;
+            default: if (position < size) {
+                        ASSERT_EQ(ll.at(position), expected[position]);
+                    } break;
+        }
+        ASSERT_EQ(ll.size(), expected.size());
+    }
+
+    ASSERT_TRUE(std::ranges::equal(ll, expected));
+    for (std::size_t i{}; i < expected.size(); ++i) {
+        ASSERT_EQ(ll.at(i), expected[i]);
+    }
+}
+
+TEST(LinkedList, indexStaysCorrectWhileListShrinks) {
+    IndexedLinkedList<int> ll{};
+    std::vector<int> expected;
+    for (int i{}; i < 10'000; ++i) {
+        ll.push_back(i);
+        expected.push_back(i);
+    }
+
+    // Erasures all over the list shrink blocks until they get merged.
+    std::mt19937 generator{11};
+    while (expected.size() > 50) {
+        const auto position = generator() % expected.size();
+        ASSERT_TRUE(ll.erase_at(position));
+        expected.erase(expected.begin() + position);
+        if (generator() % 4 == 0) {
+            ll.pop_back();
+            expected.pop_back();
+        }
+    }
+
+    for (std::size_t i{}; i < expected.size(); ++i) {
+        ASSERT_EQ(ll.at(i), expected[i]);
+    }
+    ll.push_back(-1);
+    EXPECT_EQ(ll.at(expected.size()), -1);
+}
+
+TEST(LinkedList, indexIsRebuiltAfterBulkOperations) {
+    IndexedLinkedList<int> ll{std::from_range, std::views::iota(0, 1'000)};
+    const LinkedList<int> plain{std::from_range, std::views::iota(0, 1'000)};
+
+    ll.sort(std::greater<>{});
+    EXPECT_GT(ll.memory_usage(), plain.memory_usage());
+    EXPECT_EQ(ll.at(0), 999);
+    EXPECT_EQ(ll.at(500), 499);
+
+    IndexedLinkedList<int> other{-1, -2};
+    ll.splice_after(ll.iterator_at(9), other);
+    EXPECT_EQ(ll.at(10), -1);
+    EXPECT_EQ(ll.at(12), 989);
+
+    auto tail = ll.split_after(ll.iterator_at(499));
+    EXPECT_EQ(ll.size(), 500);
+    EXPECT_EQ(tail.at(0), 501);
+    EXPECT_EQ(tail.at(501), 0);
+
+    const auto copy = tail;
+    EXPECT_EQ(copy.at(250), 251);
+
+    ll.emplace_after(ll.begin(), 7);
+    ll.remove_all(7);
+    ll.unique();
+    EXPECT_EQ(ll.at(499), 502);
+}
+
+TEST(LinkedList, popBackUsesIndex) {
+    LinkedList<int, std::allocator<int>, SequentialTraversal, CountingStats,
+               BlockIndex> ll{std::from_range, std::views::iota(0, 10'000)};
+
+    ll.pop_back();
+
+    const auto& pop_back = ll.stats().operation(LinkedListOp::PopBack);
+    EXPECT_LT(pop_back.nodes_visited, 300);
+    EXPECT_EQ(ll.back(), 9'998);
+}
+
+TEST(LinkedList, countWithoutLookup) {
+    const LinkedList<int> ll{1, 2, 1, 3, 1};
+
+    EXPECT_EQ(ll.count(1), 3);
+    EXPECT_EQ(ll.count(3), 1);
+    EXPECT_EQ(ll.count(4), 0);
+}
+
+namespace {
+
+// Whether the lookup table of `ll` agrees with a walk for every value.
+template <typename List>
+bool lookup_matches_walk(const List& ll, int max_value) {
+    for (int value{}; value <= max_value; ++value) {
+        const auto expected =
+            static_cast<std::size_t>(std::ranges::count(ll, value));
+        if (ll.count(value) != expected) return false;
+        if (ll.contains(value) != (expected > 0)) return false;
+    }
+    return true;
+}
+
+}
+
+TEST(LinkedList, hashedListMatchesVectorUnderMixedOperations) {
+    HashedLinkedList<int> ll{};
+    std::vector<int> expected;
+    std::mt19937 generator{7};
+    std::uniform_int_distribution<int> values{0, 200};
+
+    for (int step{}; step < 20'000; ++step) {
+        const auto size = expected.size();
+        const auto position = size ? generator() % (size + 1) : 0;
+        const auto value = values(generator);
+        switch (generator() % 9) {
+            case 0: ll.push_front(value);
+                    expected.insert(expected.begin(), value); break;
+            case 1: ll.push_back(value); expected.push_back(value); break;
+            case 2: if (size) { ll.pop_front();
+                                expected.erase(expected.begin()); } break;
+            case 3: if (size) { ll.pop_back(); expected.pop_back(); } break;
+            case 4: ASSERT_TRUE(ll.insert_at(position, value));
+                    expected.insert(expected.begin() + position, value);
+                    break;
+            case 5: if (position < size) {
+                        ASSERT_TRUE(ll.erase_at(position));
+                        expected.erase(expected.begin() + position);
+                    } break;
+            case 6: {
+                // Any of the equal elements may go; find out which one did.
+                ll.remove(value);
+                auto removed = expected;
+                for (std::size_t i{}; i < expected.size(); ++i) {
+                    if (expected[i] != value) continue;
+                    removed = expected;
+                    removed.erase(removed.begin() + i);
+                    if (std::ranges::equal(ll, removed)) break;
+                }
+                ASSERT_TRUE(std::ranges::equal(ll, removed));
+                expected = std::move(removed);
+                break;
+            }
+            case 7: ll.remove_all(value); std::erase(expected, value); break;
+            default: if (position < size) {
+                        ll.emplace_after(ll.iterator_at(position), value);
+                        expected.insert(expected.begin() + position + 1,
+                                        value);
+                    } break;
+        }
+        ASSERT_EQ(ll.size(), expected.size());
+        ASSERT_EQ(ll.count(value),
+                  static_cast<std::size_t>(std::ranges::count(expected,
+                                                              value)));
+        if (!expected.empty()) {
+            ASSERT_EQ(ll.back(), expected.back());
+        }
+    }
+
+    EXPECT_TRUE(std::ranges::equal(ll, expected));
+    EXPECT_TRUE(lookup_matches_walk(ll, 200));
+}
+
+TEST(LinkedList, hashLookupFollowsBulkOperations) {
+    HashedLinkedList<int> ll{std::from_range, std::views::iota(0, 100)};
+    EXPECT_TRUE(lookup_matches_walk(ll, 300));
+
+    ll.sort(std::greater<>{});
+    ll.prepend_range(std::views::iota(100, 110));
+    ll.append_range(std::views::iota(110, 120));
+    EXPECT_TRUE(lookup_matches_walk(ll, 300));
+
+    HashedLinkedList<int> other{200, 201, 202};
+    ll.splice_after(ll.iterator_at(5), other);
+    EXPECT_TRUE(other.is_empty());
+    EXPECT_FALSE(other.contains(200));
+    EXPECT_TRUE(lookup_matches_walk(ll, 300));
+
+    // Ranges within the list and from another list.
+    ll.splice_after(ll.begin(), ll, ll.iterator_at(20), ll.iterator_at(30));
+    HashedLinkedList<int> more{300, 301, 302, 303};
+    ll.splice_after(ll.iterator_at(50), more, more.begin(),
+                    more.iterator_at(3));
+    EXPECT_TRUE(lookup_matches_walk(ll, 310));
+    EXPECT_TRUE(lookup_matches_walk(more, 310));
+
+    auto tail = ll.split_after(ll.iterator_at(60));
+    EXPECT_TRUE(lookup_matches_walk(ll, 310));
+    EXPECT_TRUE(lookup_matches_walk(tail, 310));
+
+    ll.sort();
+    tail.sort();
+    ll.merge(std::move(tail));
+    EXPECT_TRUE(lookup_matches_walk(ll, 310));
+
+    ll.push_back(ll.back()->get());
+    EXPECT_EQ(ll.unique(), 1);
+    ll.relinearize();
+    EXPECT_TRUE(lookup_matches_walk(ll, 310));
+
+    auto copy = ll;
+    HashedLinkedList<int> moved{std::move(ll)};
+    EXPECT_TRUE(lookup_matches_walk(copy, 310));
+    EXPECT_TRUE(lookup_matches_walk(moved, 310));
+    EXPECT_FALSE(ll.contains(1));
+
+    HashedLinkedList<int> empty{};
+    empty.append(std::move(moved));
+    EXPECT_TRUE(lookup_matches_walk(empty, 310));
+    swap(empty, copy);
+    EXPECT_TRUE(lookup_matches_walk(empty, 310));
+    EXPECT_TRUE(lookup_matches_walk(copy, 310));
+
+    copy.clear();
+    EXPECT_FALSE(copy.contains(5));
+}
+
+TEST(LinkedList, hashLookupByKey) {
+    struct Record {
+        int         id;
+        std::string payload;
+
+        bool operator==(const Record&) const = default;
+    };
+    HashedLinkedList<Record, std::allocator<Record>,
+                     decltype([](const Record& r) { return r.id; })> ll{};
+
+    ll.push_back({1, "one"});
+    ll.push_back({2, "two"});
+    ll.push_back({1, "uno"});
+
+    EXPECT_TRUE(ll.contains({1, "uno"}));
+    EXPECT_FALSE(ll.contains({1, "eins"}));
+    EXPECT_EQ(ll.count({1, "one"}), 1);
+
+    ll.remove({1, "one"});
+    EXPECT_EQ(ll.size(), 2);
+    EXPECT_EQ(ll.front()->get().payload, "two");
+}
+
+TEST(LinkedList, hashLookupVisitsOnlyMatches) {
+    LinkedList<int, std::allocator<int>, SequentialTraversal, CountingStats,
+               NoIndex, HashLookup<>> ll{std::from_range,
+                                         std::views::iota(0, 10'000)};
+
+    EXPECT_TRUE(ll.contains(9'999));
+    EXPECT_FALSE(ll.contains(10'000));
+    ll.remove(5'000);
+    ll.remove_all(7'000);
+
+    const auto& contains = ll.stats().operation(LinkedListOp::Contains);
+    EXPECT_EQ(contains.calls, 2);
+    EXPECT_EQ(contains.max_nodes_visited, 1);
+    EXPECT_EQ(ll.stats().operation(LinkedListOp::RemoveAll).nodes_visited, 1);
+    EXPECT_EQ(ll.size(), 9'998);
+}
+
+TEST(LinkedList, hashLookupMemoryIsReported) {
+    const LinkedList<int> plain{std::from_range, std::views::iota(0, 1'000)};
+    const HashedLinkedList<int> hashed{std::from_range,
+                                       std::views::iota(0, 1'000)};
+
+    EXPECT_GE(hashed.memory_usage(),
+              plain.memory_usage() + 1'000 * 2 * sizeof(void*));
+}
+
+TEST(LinkedList, hashedAndIndexedTogether) {
+    LinkedList<int, std::allocator<int>, SequentialTraversal, NoStats,
+               BlockIndex, HashLookup<>> ll{std::from_range,
+                                            std::views::iota(0, 1'000)};
+
+    ll.remove(500);
+    EXPECT_EQ(ll.at(500), 501);
+    ll.remove_all(0);
+    EXPECT_EQ(ll.at(0), 1);
+    EXPECT_EQ(ll.size(), 998);
+    EXPECT_TRUE(lookup_matches_walk(ll, 1'000));
+}
+
+namespace {
+
+// Throws std::bad_alloc once `budget` allocations have been made; a
+// negative budget never runs out.
+template <typename T>
+struct LimitedAllocator {
+    using value_type = T;
+
+    int* budget;
+
+    explicit LimitedAllocator(int* b) : budget{b} {}
+
+    template <typename U>
+    LimitedAllocator(const LimitedAllocator<U>& other)
+        : budget{other.budget} {}
+
+    T* allocate(std::size_t n) {
+        if (*budget == 0) throw std::bad_alloc{};
+        if (*budget > 0) --*budget;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) {
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    friend bool operator==(const LimitedAllocator&,
+                           const LimitedAllocator&) = default;
+};
+
+}
+
+TEST(LinkedList, failedLookupUpdateLeavesListUnchanged) {
+    using List = LinkedList<int, LimitedAllocator<int>, SequentialTraversal,
+                            NoStats, NoIndex, HashLookup<>>;
+    int budget{-1};
+    const LimitedAllocator<int> alloc{&budget};
+    List ll{{1, 2, 3}, alloc};
+    List other{{9, 10}, alloc};
+    const List source{{4, 5, 6, 7}, alloc};
+    // Nodes come from the pool, so only the lookup table allocates.
+    ll.reserve(32);
+
+    budget = 0;
+    EXPECT_THROW(ll.push_back(4), std::bad_alloc);
+    EXPECT_THROW(ll.push_front(0), std::bad_alloc);
+    EXPECT_THROW((void)ll.insert_at(1, 5), std::bad_alloc);
+    EXPECT_THROW(ll.emplace_after(ll.cbegin(), 6), std::bad_alloc);
+    EXPECT_THROW(ll.splice_after(ll.cbegin(), other), std::bad_alloc);
+    EXPECT_THROW(ll = source, std::bad_alloc);
+    budget = 1;
+    EXPECT_THROW(ll.append_range(std::vector{7, 8}), std::bad_alloc);
+    budget = 1;
+    EXPECT_THROW(ll.prepend_range(std::vector{7, 8}), std::bad_alloc);
+
+    budget = -1;
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 2 -> 3 -> NULL]");
+    EXPECT_TRUE(lookup_matches_walk(ll, 10));
+    EXPECT_EQ(std::format("{}", other), "[9 -> 10 -> NULL]");
+    EXPECT_TRUE(lookup_matches_walk(other, 10));
+
+    ll.splice_after(ll.cbegin(), other, other.cbegin(), other.cend());
+    ll.splice_after(ll.cbegin(), ll, ++++ll.cbegin(), ll.cend());
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 3 -> 10 -> 2 -> NULL]");
+    EXPECT_TRUE(lookup_matches_walk(ll, 10));
+
+    ll = source;
+    EXPECT_EQ(ll, source);
+    EXPECT_TRUE(lookup_matches_walk(ll, 10));
+}
+
+TEST(LinkedList, failedLookupRebuildLeavesNoStaleTable) {
+    using List = LinkedList<int, LimitedAllocator<int>, SequentialTraversal,
+                            NoStats, NoIndex, HashLookup<>>;
+    int budget{-1};
+    const LimitedAllocator<int> alloc{&budget};
+    List ll{{3, 1, 2, 2}, alloc};
+    List other{{0, 4}, alloc};
+
+    // Relinked first; only rebuilding the table runs out.
+    budget = 0;
+    EXPECT_THROW(ll.sort(), std::bad_alloc);
+    EXPECT_THROW(ll.merge(std::move(other)), std::bad_alloc);
+    EXPECT_EQ(ll.unique(), 1);
+    budget = -1;
+    EXPECT_EQ(std::format("{}", ll), "[0 -> 1 -> 2 -> 3 -> 4 -> NULL]");
+    EXPECT_TRUE(other.is_empty());
+    EXPECT_TRUE(lookup_matches_walk(ll, 10));
+
+    // Nothing is relinked when the table of either list fails.
+    budget = 0;
+    EXPECT_THROW((void)ll.split_after(++ll.cbegin()), std::bad_alloc);
+    budget = 2;
+    EXPECT_THROW(ll.relinearize(), std::bad_alloc);
+    budget = -1;
+    EXPECT_EQ(std::format("{}", ll), "[0 -> 1 -> 2 -> 3 -> 4 -> NULL]");
+
+    ll.remove(2);
+    (void)ll.erase_at(1);
+    ll.remove_all(4);
+    ll.push_back(1);
+    EXPECT_EQ(std::format("{}", ll), "[0 -> 3 -> 1 -> NULL]");
+    EXPECT_TRUE(lookup_matches_walk(ll, 10));
+
+    auto tail = ll.split_after(ll.cbegin());
+    ll.relinearize();
+    EXPECT_EQ(std::format("{}", tail), "[3 -> 1 -> NULL]");
+    EXPECT_TRUE(lookup_matches_walk(ll, 10));
+    EXPECT_TRUE(lookup_matches_walk(tail, 10));
+}
+
+namespace {
+
+// Counts the allocations made through it; propagates on every assignment.
+template <typename T>
+struct PropagatingAllocator {
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+
+    std::size_t* allocations;
+
+    explicit PropagatingAllocator(std::size_t* a) : allocations{a} {}
+
+    template <typename U>
+    PropagatingAllocator(const PropagatingAllocator<U>& other)
+        : allocations{other.allocations} {}
+
+    T* allocate(std::size_t n) {
+        ++*allocations;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) {
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    friend bool operator==(const PropagatingAllocator&,
+                           const PropagatingAllocator&) = default;
+};
+
+}
+
+TEST(LinkedList, propagatedAllocatorIsUsedByIndexAndLookup) {
+    using List = LinkedList<int, PropagatingAllocator<int>,
+                            SequentialTraversal, NoStats, BlockIndex,
+                            HashLookup<>>;
+    std::size_t first{};
+    std::size_t second{};
+    List l1{{1, 2}, PropagatingAllocator<int>{&first}};
+    List l2{{3}, PropagatingAllocator<int>{&second}};
+    List l3{{4}, PropagatingAllocator<int>{&first}};
+
+    const auto grow = [](List& ll) {
+        for (int i{}; i < 2'000; ++i) ll.push_back(i);
+        return ll.at(1'000);
+    };
+
+    l1 = l2;
+    l3 = std::move(l2);
+    first = 0;
+    EXPECT_EQ(grow(l1), 999);
+    EXPECT_EQ(grow(l2), 1'000);
+    EXPECT_EQ(grow(l3), 999);
+    EXPECT_TRUE(l1.contains(1'999));
+    EXPECT_TRUE(l2.contains(1'999));
+    EXPECT_EQ(first, 0);
+}
+
@@ -0,0 +1,200 @@
+#include "LinkedList/OrderedLinkedList.hpp"
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <format>
+#include <functional>
+#include <memory_resource>
+#include <random>
+#include <ranges>
+#include <set>
+#include <string>
+#include <sstream>
+#include <vector>
+
+TEST(OrderedLinkedList, canCreateEmptyList) {
+    OrderedLinkedList<int> ll{};
+
+    EXPECT_TRUE(ll.is_empty());
+    EXPECT_EQ(ll.size(), 0);
+    EXPECT_EQ(ll.begin(), ll.end());
+    EXPECT_FALSE(ll.contains(1));
+    EXPECT_EQ(ll.lower_bound(1), ll.end());
+    EXPECT_EQ(ll.front(), std::unexpected(LinkedListError::EmptyList));
+    EXPECT_EQ(ll.back(), std::unexpected(LinkedListError::EmptyList));
+    EXPECT_EQ(std::format("{}", ll), "[NULL]");
+}
+
+TEST(OrderedLinkedList, keepsElementsSorted) {
+    OrderedLinkedList<int> ll{5, 1, 4, 2, 3};
+
+    EXPECT_EQ(ll.size(), 5);
+    EXPECT_EQ(ll.front(), 1);
+    EXPECT_EQ(ll.back(), 5);
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 2 -> 3 -> 4 -> 5 -> NULL]");
+
+    std::stringstream ss;
+    ss << ll;
+    EXPECT_EQ(ss.str(), "[1 -> 2 -> 3 -> 4 -> 5 -> NULL]");
+
+    ll.insert(0);
+    ll.insert(6);
+    EXPECT_EQ(ll.front(), 0);
+    EXPECT_EQ(ll.back(), 6);
+}
+
+TEST(OrderedLinkedList, usesComparator) {
+    OrderedLinkedList<std::string, std::greater<>> ll{"b", "c", "a"};
+
+    EXPECT_EQ(std::format("{}", ll), "[c -> b -> a -> NULL]");
+    EXPECT_TRUE(ll.contains("a"));
+    EXPECT_EQ(*ll.lower_bound("bb"), "b");
+}
+
+TEST(OrderedLinkedList, lowerBoundAndContains) {
+    OrderedLinkedList<int> ll{10, 20, 30};
+
+    EXPECT_EQ(*ll.lower_bound(5), 10);
+    EXPECT_EQ(*ll.lower_bound(20), 20);
+    EXPECT_EQ(*ll.lower_bound(21), 30);
+    EXPECT_EQ(ll.lower_bound(31), ll.end());
+
+    EXPECT_TRUE(ll.contains(20));
+    EXPECT_FALSE(ll.contains(25));
+}
+
+TEST(OrderedLinkedList, rangeYieldsHalfOpenInterval) {
+    OrderedLinkedList<int> ll{1, 3, 5, 7, 9};
+
+    EXPECT_TRUE(std::ranges::equal(ll.range(3, 8), std::vector{3, 5, 7}));
+    EXPECT_TRUE(ll.range(4, 5).empty());
+    EXPECT_TRUE(ll.range(8, 3).empty());
+    EXPECT_TRUE(std::ranges::equal(ll.range(0, 100), ll));
+}
+
+TEST(OrderedLinkedList, keepsEquivalentElementsInInsertionOrder) {
+    using Pair = std::pair<int, char>;
+    const auto by_key = [](const Pair& lhs, const Pair& rhs) {
+        return lhs.first < rhs.first;
+    };
+    OrderedLinkedList<Pair, decltype(by_key)> ll{by_key};
+
+    ll.insert({1, 'a'});
+    ll.insert({0, 'b'});
+    ll.insert({1, 'c'});
+    ll.insert({1, 'd'});
+
+    std::string order;
+    for (const auto& [key, tag] : ll) order += tag;
+    EXPECT_EQ(order, "bacd");
+
+    const auto it = std::ranges::find(ll, Pair{1, 'c'});
+    ll.erase(it);
+    order.clear();
+    for (const auto& [key, tag] : ll) order += tag;
+    EXPECT_EQ(order, "bad");
+}
+
+TEST(OrderedLinkedList, eraseByValueRemovesAllEquivalent) {
+    OrderedLinkedList<int> ll{2, 1, 2, 3, 2};
+
+    EXPECT_EQ(ll.erase(2), 3);
+    EXPECT_EQ(ll.erase(4), 0);
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 3 -> NULL]");
+    EXPECT_EQ(ll.back(), 3);
+
+    EXPECT_EQ(ll.erase(3), 1);
+    EXPECT_EQ(ll.back(), 1);
+    EXPECT_EQ(ll.erase(1), 1);
+    EXPECT_TRUE(ll.is_empty());
+    EXPECT_EQ(ll.back(), std::unexpected(LinkedListError::EmptyList));
+}
+
+TEST(OrderedLinkedList, eraseReturnsNextPosition) {
+    OrderedLinkedList<int> ll{1, 2, 3};
+
+    auto it = ll.erase(ll.lower_bound(2));
+    EXPECT_EQ(*it, 3);
+    it = ll.erase(it);
+    EXPECT_EQ(it, ll.end());
+    EXPECT_EQ(ll.back(), 1);
+
+    ll.pop_front();
+    EXPECT_TRUE(ll.is_empty());
+    ll.pop_front();
+    EXPECT_TRUE(ll.is_empty());
+}
+
+TEST(OrderedLinkedList, copyAndMove) {
+    const OrderedLinkedList<std::string> ll{"b", "a", "c"};
+
+    auto copy = ll;
+    EXPECT_EQ(copy, ll);
+    copy.insert("d");
+    EXPECT_EQ(copy.back()->get(), "d");
+    EXPECT_EQ(ll.size(), 3);
+
+    auto moved = std::move(copy);
+    EXPECT_TRUE(copy.is_empty());
+    EXPECT_EQ(std::format("{}", moved), "[a -> b -> c -> d -> NULL]");
+
+    copy = ll;
+    EXPECT_EQ(copy, ll);
+    copy = std::move(moved);
+    EXPECT_EQ(copy.size(), 4);
+    EXPECT_TRUE(copy.contains("d"));
+
+    swap(copy, moved);
+    EXPECT_TRUE(copy.is_empty());
+    EXPECT_EQ(moved.size(), 4);
+}
+
+TEST(OrderedLinkedList, pmrMoveWithDifferentResourceMovesElements) {
+    std::pmr::monotonic_buffer_resource r1;
+    std::pmr::monotonic_buffer_resource r2;
+    pmr::OrderedLinkedList<int> ll{&r1};
+    for (int i{}; i < 100; ++i) ll.insert(99 - i);
+
+    pmr::OrderedLinkedList<int> other{std::move(ll), &r2};
+    EXPECT_EQ(other.get_allocator().resource(), &r2);
+    EXPECT_EQ(other.size(), 100);
+    EXPECT_TRUE(ll.is_empty());
+    EXPECT_TRUE(std::ranges::equal(other, std::views::iota(0, 100)));
+    EXPECT_TRUE(other.contains(57));
+}
+
+TEST(OrderedLinkedList, matchesMultisetUnderRandomOperations) {
+    OrderedLinkedList<int, std::less<>, 8> ll{};
+    std::multiset<int> expected;
+    std::mt19937 generator{7};
+    std::uniform_int_distribution<int> values{0, 500};
+
+    for (int step{}; step < 20'000; ++step) {
+        const auto value = values(generator);
+        switch (generator() % 4) {
+        case 0:
+        case 1:
+            ll.insert(value);
+            expected.insert(value);
+            break;
+        case 2:
+            EXPECT_EQ(ll.erase(value), expected.erase(value));
+            break;
+        default:
+            if (const auto it = ll.lower_bound(value); it != ll.end()) {
+                EXPECT_EQ(*it, *expected.lower_bound(value));
+                ll.erase(it);
+                expected.erase(expected.lower_bound(value));
+            } else {
+                EXPECT_EQ(expected.lower_bound(value), expected.end());
+            }
+        }
+        ASSERT_EQ(ll.size(), expected.size());
+        ASSERT_EQ(ll.contains(value), expected.contains(value));
+        if (!expected.empty()) {
+            ASSERT_EQ(ll.back(), *expected.rbegin());
+        }
+    }
+    EXPECT_TRUE(std::ranges::equal(ll, expected));
+}
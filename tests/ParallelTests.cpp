@@ -0,0 +1,132 @@
+#include "LinkedList/Parallel.hpp"
+#include "LinkedList/LinkedList.hpp"
+#include "LinkedList/DoublyLinkedList.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <format>
+#include <functional>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(Parallel, forEachVisitsEveryElementOnce) {
+    WorkStealingPool pool{4};
+    LinkedList<int> ll{std::from_range, std::views::iota(0, 10'000)};
+
+    std::vector<std::atomic<int>> visits(10'000);
+    parallel_for_each(ll, [&visits](int element) { ++visits[element]; },
+                      pool);
+
+    for (const auto& count : visits) {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+TEST(Parallel, transformInplace) {
+    WorkStealingPool pool{3};
+    LinkedList<int> ll{std::from_range, std::views::iota(0, 1'000)};
+
+    parallel_transform_inplace(ll, [](int element) { return element * 2; },
+                               pool);
+
+    int expected{};
+    for (const auto element : ll) {
+        EXPECT_EQ(element, expected);
+        expected += 2;
+    }
+}
+
+TEST(Parallel, reduceKeepsListOrder) {
+    WorkStealingPool pool{4};
+    LinkedList<std::string> ll{};
+    std::string expected;
+    for (int i{}; i < 200; ++i) {
+        ll.push_back(std::to_string(i));
+        expected += std::to_string(i);
+    }
+
+    const auto result = parallel_reduce(ll, std::string{"> "},
+        [](std::string lhs, const std::string& rhs) { return lhs + rhs; },
+        pool);
+
+    EXPECT_EQ(result, "> " + expected);
+}
+
+TEST(Parallel, reduceSum) {
+    const LinkedList<long long> ll{
+        std::from_range, std::views::iota(1LL, 100'001LL)};
+
+    EXPECT_EQ(parallel_reduce(ll, 0LL, std::plus<>{}), 5'000'050'000LL);
+}
+
+TEST(Parallel, emptyAndShortLists) {
+    WorkStealingPool pool{8};
+    LinkedList<int> empty{};
+    LinkedList<int> two{1, 2};
+
+    parallel_for_each(empty, [](int) { FAIL(); }, pool);
+    EXPECT_EQ(parallel_reduce(empty, 7, std::plus<>{}, pool), 7);
+
+    parallel_transform_inplace(two, [](int element) { return -element; },
+                               pool);
+    EXPECT_EQ(std::format("{}", two), "[-1 -> -2 -> NULL]");
+    EXPECT_EQ(parallel_reduce(two, 0, std::plus<>{}, pool), -3);
+}
+
+TEST(Parallel, rethrowsExceptionFromElement) {
+    WorkStealingPool pool{4};
+    LinkedList<int> ll{std::from_range, std::views::iota(0, 1'000)};
+
+    EXPECT_THROW(parallel_for_each(ll, [](int element) {
+        if (element == 567) throw std::runtime_error{"bad element"};
+    }, pool), std::runtime_error);
+
+    // The pool is still usable.
+    EXPECT_EQ(parallel_reduce(ll, 0, std::plus<>{}, pool), 499'500);
+}
+
+TEST(Parallel, runsOnSeveralThreads) {
+    WorkStealingPool pool{4};
+    LinkedList<int> ll{std::from_range, std::views::iota(0, 64)};
+
+    std::atomic<int> running{};
+    std::atomic<int> max_running{};
+    parallel_for_each(ll, [&](int) {
+        const auto now = ++running;
+        for (auto seen{max_running.load()};
+                now > seen && !max_running.compare_exchange_weak(seen, now););
+        std::this_thread::sleep_for(std::chrono::milliseconds{2});
+        --running;
+    }, pool);
+
+    EXPECT_GT(max_running, 1);
+}
+
+TEST(Parallel, nestedRunDoesNotDeadlock) {
+    WorkStealingPool pool{2};
+    LinkedList<int> outer{1, 2, 3, 4, 5, 6, 7, 8};
+
+    std::atomic<int> total{};
+    parallel_for_each(outer, [&](int element) {
+        LinkedList<int> inner{
+            std::from_range, std::views::iota(0, element)};
+        total += parallel_reduce(inner, 0, std::plus<>{}, pool);
+    }, pool);
+
+    EXPECT_EQ(total, 84);
+}
+
+TEST(Parallel, worksWithOtherLists) {
+    WorkStealingPool pool{2};
+    DoublyLinkedList<int> ll{1, 2, 3, 4};
+
+    parallel_transform_inplace(ll, [](int element) { return element + 1; },
+                               pool);
+
+    EXPECT_EQ(parallel_reduce(ll, 0, std::plus<>{}, pool), 14);
+}
@@ -0,0 +1,288 @@
+#include "LinkedList/PersistentLinkedList.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <unistd.h>
+
+namespace {
+
+struct Point {
+    int    x;
+    double y;
+
+    bool operator==(const Point&) const = default;
+};
+
+// A file in the temporary directory, removed at the end of the test.
+class TemporaryFile {
+    std::filesystem::path path_;
+
+public:
+    TemporaryFile()
+        : path_{std::filesystem::temp_directory_path() / std::format(
+              "{}.{}.{}", ::testing::UnitTest::GetInstance()
+                              ->current_test_info()->name(),
+              ::getpid(), "llpersist")} {}
+
+    ~TemporaryFile() {
+        std::error_code ec;
+        std::filesystem::remove(path_, ec);
+    }
+
+    const std::filesystem::path& path() const { return path_; }
+};
+
+std::vector<int> elements(const PersistentLinkedList<int>& ll) {
+    return {ll.begin(), ll.end()};
+}
+
+// Reads `value` from, or writes it to, `offset` in the file at `path`.
+template <typename U>
+U read_at(const std::filesystem::path& path, std::uint64_t offset) {
+    std::ifstream file{path, std::ios::binary};
+    file.seekg(static_cast<std::streamoff>(offset));
+    U value{};
+    file.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return value;
+}
+
+template <typename U>
+void write_at(const std::filesystem::path& path, std::uint64_t offset,
+              const U& value) {
+    std::fstream file{path, std::ios::binary | std::ios::in | std::ios::out};
+    file.seekp(static_cast<std::streamoff>(offset));
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+// Offset of the slot holding the latest state.
+std::uint64_t latest_slot(const std::filesystem::path& path) {
+    const auto file = read_at<PersistentListHeader>(path, 0);
+    const auto latest =
+        file.slots[1].sequence > file.slots[0].sequence ? 1 : 0;
+    return offsetof(PersistentListHeader, slots) +
+           latest * sizeof(PersistentListState);
+}
+
+}
+
+TEST(PersistentLinkedList, createPushAndIterate) {
+    TemporaryFile file;
+    auto ll = PersistentLinkedList<int>::create(file.path());
+    ASSERT_TRUE(ll);
+    EXPECT_TRUE(ll->is_empty());
+    EXPECT_EQ(ll->front().error(), LinkedListError::EmptyList);
+
+    ll->push_back(2);
+    ll->push_back(3);
+    ll->push_front(1);
+
+    EXPECT_EQ(ll->size(), 3);
+    EXPECT_EQ(elements(*ll), (std::vector{1, 2, 3}));
+    EXPECT_EQ(ll->front(), 1);
+    EXPECT_EQ(ll->back(), 3);
+    EXPECT_TRUE(ll->contains(2));
+    EXPECT_FALSE(ll->contains(4));
+
+    *ll->begin() = 10;
+    EXPECT_EQ(ll->front(), 10);
+}
+
+TEST(PersistentLinkedList, popAndRemove) {
+    TemporaryFile file;
+    auto ll = PersistentLinkedList<int>::create(file.path());
+    ASSERT_TRUE(ll);
+    for (int i{}; i < 6; ++i) ll->push_back(i);
+
+    ll->pop_front();
+    ll->pop_back();
+    EXPECT_EQ(elements(*ll), (std::vector{1, 2, 3, 4}));
+
+    ll->remove(4);
+    EXPECT_EQ(ll->back(), 3);
+    ll->remove(2);
+    ll->remove(1);
+    ll->remove(7);
+    EXPECT_EQ(elements(*ll), (std::vector{3}));
+
+    ll->pop_back();
+    EXPECT_TRUE(ll->is_empty());
+    ll->pop_back();
+    ll->pop_front();
+
+    ll->push_back(5);
+    EXPECT_EQ(ll->front(), 5);
+    EXPECT_EQ(ll->back(), 5);
+}
+
+TEST(PersistentLinkedList, persistsAcrossReopen) {
+    TemporaryFile file;
+    {
+        auto ll = PersistentLinkedList<Point>::create(file.path());
+        ASSERT_TRUE(ll);
+        ll->push_back({1, 0.5});
+        ll->push_back({2, 1.5});
+        ll->sync();
+    }
+
+    auto ll = PersistentLinkedList<Point>::open(file.path());
+    ASSERT_TRUE(ll);
+    EXPECT_EQ(ll->size(), 2);
+    EXPECT_EQ(ll->back(), (Point{2, 1.5}));
+
+    ll->push_back({3, 2.5});
+    ll = *PersistentLinkedList<Point>::open(file.path());
+    EXPECT_EQ(ll->size(), 3);
+    EXPECT_EQ(ll->back(), (Point{3, 2.5}));
+}
+
+TEST(PersistentLinkedList, growsAndReusesFreedNodes) {
+    TemporaryFile file;
+    auto ll = PersistentLinkedList<std::int64_t>::create(file.path());
+    ASSERT_TRUE(ll);
+    const auto initial = ll->file_size();
+
+    for (std::int64_t i{}; i < 100'000; ++i) ll->push_back(i);
+    EXPECT_GT(ll->file_size(), initial);
+    EXPECT_EQ(std::filesystem::file_size(file.path()), ll->file_size());
+
+    const auto grown = ll->file_size();
+    for (int i{}; i < 100'000; ++i) {
+        ll->pop_front();
+        ll->push_back(i);
+    }
+    EXPECT_EQ(ll->file_size(), grown);
+
+    ll = *PersistentLinkedList<std::int64_t>::open(file.path());
+    EXPECT_EQ(ll->size(), 100'000);
+    EXPECT_EQ(ll->front(), 0);
+    EXPECT_EQ(ll->back(), 99'999);
+
+    ll->clear();
+    EXPECT_TRUE(ll->is_empty());
+    ll->push_back(1);
+    EXPECT_EQ(ll->front(), 1);
+}
+
+TEST(PersistentLinkedList, readOnlyMode) {
+    TemporaryFile file;
+    {
+        auto ll = PersistentLinkedList<int>::create(file.path());
+        ASSERT_TRUE(ll);
+        ll->push_back(1);
+        ll->push_back(2);
+    }
+
+    auto reader1 = PersistentLinkedList<int>::open(file.path(),
+                                                   PersistentMode::ReadOnly);
+    auto reader2 = PersistentLinkedList<int>::open(file.path(),
+                                                   PersistentMode::ReadOnly);
+    ASSERT_TRUE(reader1);
+    ASSERT_TRUE(reader2);
+    EXPECT_EQ(*reader1, *reader2);
+    EXPECT_EQ(elements(*reader1), (std::vector{1, 2}));
+
+    EXPECT_THROW(reader1->push_back(3), std::system_error);
+    EXPECT_THROW(reader1->pop_front(), std::system_error);
+    EXPECT_THROW(reader1->sync(), std::system_error);
+    EXPECT_EQ(reader1->size(), 2);
+}
+
+TEST(PersistentLinkedList, rejectsOtherFiles) {
+    TemporaryFile file;
+    EXPECT_EQ(PersistentLinkedList<int>::open(file.path()).error(),
+              PersistentListError::SystemError);
+
+    { std::ofstream{file.path()} << "not a list"; }
+    EXPECT_EQ(PersistentLinkedList<int>::open(file.path()).error(),
+              PersistentListError::InvalidFile);
+
+    ASSERT_TRUE(PersistentLinkedList<int>::create(file.path()));
+    EXPECT_EQ(PersistentLinkedList<double>::open(file.path()).error(),
+              PersistentListError::IncompatibleElement);
+
+    write_at(file.path(), offsetof(PersistentListHeader, version),
+             std::uint32_t{9});
+    EXPECT_EQ(PersistentLinkedList<int>::open(file.path()).error(),
+              PersistentListError::UnsupportedVersion);
+}
+
+TEST(PersistentLinkedList, recoversFromTornCommit) {
+    TemporaryFile file;
+    {
+        auto ll = PersistentLinkedList<int>::create(file.path());
+        ASSERT_TRUE(ll);
+        ll->push_back(1);
+        ll->push_back(2);
+        ll->push_back(3);
+    }
+
+    // A writer dying halfway through the commit of push_back(3) leaves its
+    // slot with a bad checksum, and 2 not yet linked to 3.
+    const auto slot = latest_slot(file.path());
+    const auto state = read_at<PersistentListState>(file.path(), slot);
+    write_at(file.path(), state.redo_node, std::uint64_t{0});
+    write_at(file.path(), slot + offsetof(PersistentListState, checksum),
+             state.checksum + 1);
+
+    auto ll = PersistentLinkedList<int>::open(file.path());
+    ASSERT_TRUE(ll);
+    EXPECT_EQ(elements(*ll), (std::vector{1, 2}));
+
+    ll->push_back(4);
+    EXPECT_EQ(elements(*ll), (std::vector{1, 2, 4}));
+}
+
+TEST(PersistentLinkedList, reappliesLinkAfterCommit) {
+    TemporaryFile file;
+    {
+        auto ll = PersistentLinkedList<int>::create(file.path());
+        ASSERT_TRUE(ll);
+        ll->push_back(1);
+        ll->push_back(2);
+        ll->push_back(3);
+        ll->remove(2);
+    }
+
+    // A writer dying after committing remove(2) but before relinking 1.
+    const auto state = read_at<PersistentListState>(
+        file.path(), latest_slot(file.path()));
+    ASSERT_NE(state.redo_node, 0);
+    write_at(file.path(), state.redo_node,
+             state.redo_next - sizeof(PersistentNode<int>));
+
+    auto reader = PersistentLinkedList<int>::open(file.path(),
+                                                  PersistentMode::ReadOnly);
+    ASSERT_TRUE(reader);
+    EXPECT_EQ(elements(*reader), (std::vector{1, 3}));
+
+    auto ll = PersistentLinkedList<int>::open(file.path());
+    ASSERT_TRUE(ll);
+    EXPECT_EQ(elements(*ll), (std::vector{1, 3}));
+    EXPECT_EQ(ll->size(), 2);
+}
+
+TEST(PersistentLinkedList, moveAndPrint) {
+    TemporaryFile file;
+    auto created = PersistentLinkedList<int>::create(file.path());
+    ASSERT_TRUE(created);
+    created->push_back(1);
+    created->push_back(2);
+
+    auto ll = std::move(*created);
+    EXPECT_EQ(ll.size(), 2);
+
+    std::stringstream ss;
+    ss << ll;
+    EXPECT_EQ(ss.str(), "[1 -> 2 -> NULL]");
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 2 -> NULL]");
+}
@@ -0,0 +1,241 @@
+#include "LinkedList/Serialization.hpp"
+#include "LinkedList/LinkedList.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <memory_resource>
+#include <ostream>
+#include <ranges>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Point {
+    int    x;
+    double y;
+
+    bool operator==(const Point&) const = default;
+};
+
+// Not trivially copyable: written through its ElementSerializer.
+struct Tagged {
+    std::string tag;
+    int         value;
+
+    bool operator==(const Tagged&) const = default;
+};
+
+// A stream buffer over a string that cannot seek, as a pipe or a socket.
+class UnseekableBuffer : public std::streambuf {
+public:
+    explicit UnseekableBuffer(std::string& bytes) {
+        setg(bytes.data(), bytes.data(), bytes.data() + bytes.size());
+    }
+};
+
+}
+
+template <>
+struct ElementSerializer<Tagged> {
+    static void write(std::ostream& os, const Tagged& element) {
+        ElementSerializer<std::string>::write(os, element.tag);
+        os.write(reinterpret_cast<const char*>(&element.value),
+                 sizeof(element.value));
+    }
+
+    static Tagged read(std::istream& is) {
+        Tagged element{ElementSerializer<std::string>::read(is), 0};
+        is.read(reinterpret_cast<char*>(&element.value),
+                sizeof(element.value));
+        return element;
+    }
+};
+
+TEST(Serialization, roundTripThroughStream) {
+    const LinkedList<int> ll{std::from_range, std::views::iota(0, 100'000)};
+
+    std::stringstream ss;
+    ASSERT_TRUE(serialize(ll, ss));
+    EXPECT_EQ(ss.str().size(), serialized_size(ll));
+    EXPECT_EQ(ss.str().size(), 24 + 100'000 * sizeof(int));
+
+    const auto loaded = deserialize<LinkedList<int>>(ss);
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(*loaded, ll);
+    EXPECT_EQ(loaded->back(), 99'999);
+}
+
+TEST(Serialization, roundTripThroughBuffer) {
+    const LinkedList<Point> ll{{1, 0.5}, {2, 1.5}, {3, 2.5}};
+
+    std::vector<std::byte> buffer(serialized_size(ll));
+    const auto written = serialize(ll, std::span{buffer});
+    ASSERT_TRUE(written);
+    EXPECT_EQ(*written, buffer.size());
+
+    const auto loaded = deserialize<LinkedList<Point>>(std::span{
+        std::as_const(buffer)});
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(*loaded, ll);
+}
+
+TEST(Serialization, emptyList) {
+    const LinkedList<int> ll{};
+
+    std::stringstream ss;
+    ASSERT_TRUE(serialize(ll, ss));
+    const auto loaded = deserialize<LinkedList<int>>(ss);
+    ASSERT_TRUE(loaded);
+    EXPECT_TRUE(loaded->is_empty());
+}
+
+TEST(Serialization, loadedListDoesNotRecycleNodes) {
+    const LinkedList<std::int64_t> ll{
+        std::from_range, std::views::iota(std::int64_t{}, 50'000)};
+    std::stringstream ss;
+    ASSERT_TRUE(serialize(ll, ss));
+    const auto bytes = ss.str();
+
+    // Popped nodes go back to the allocator instead of being kept for
+    // reuse.
+    const auto check = [&ll](LinkedList<std::int64_t>& loaded) {
+        if (loaded != ll) return false;
+        loaded.pop_front();
+        return loaded.capacity() == loaded.size();
+    };
+
+    auto from_stream = deserialize<LinkedList<std::int64_t>>(ss);
+    ASSERT_TRUE(from_stream);
+    EXPECT_TRUE(check(*from_stream));
+
+    auto from_buffer = deserialize<LinkedList<std::int64_t>>(
+        std::as_bytes(std::span{bytes}));
+    ASSERT_TRUE(from_buffer);
+    EXPECT_TRUE(check(*from_buffer));
+}
+
+TEST(Serialization, elementSerializerForStrings) {
+    const LinkedList<std::string> ll{"", "one", std::string(10'000, 'x')};
+
+    std::stringstream ss;
+    ASSERT_TRUE(serialize(ll, ss));
+    EXPECT_EQ(ss.str().size(), serialized_size(ll));
+
+    const auto loaded = deserialize<LinkedList<std::string>>(ss);
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(*loaded, ll);
+
+    std::vector<std::byte> buffer(serialized_size(ll));
+    ASSERT_TRUE(serialize(ll, std::span{buffer}));
+    const auto from_buffer = deserialize<LinkedList<std::string>>(
+        std::span{std::as_const(buffer)});
+    ASSERT_TRUE(from_buffer);
+    EXPECT_EQ(*from_buffer, ll);
+}
+
+TEST(Serialization, userElementSerializer) {
+    const LinkedList<Tagged> ll{{"a", 1}, {"bc", 2}};
+
+    std::stringstream ss;
+    ASSERT_TRUE(serialize(ll, ss));
+    const auto loaded = deserialize<LinkedList<Tagged>>(ss);
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(*loaded, ll);
+}
+
+TEST(Serialization, loadsIntoAnyPolicyAndAllocator) {
+    const LinkedList<int> ll{3, 1, 2};
+    std::stringstream ss;
+    ASSERT_TRUE(serialize(ll, ss));
+    const auto bytes = ss.str();
+
+    std::pmr::monotonic_buffer_resource resource;
+    const auto loaded = deserialize<pmr::LinkedList<int>>(
+        std::as_bytes(std::span{bytes}), &resource);
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(loaded->get_allocator().resource(), &resource);
+    EXPECT_TRUE(std::ranges::equal(*loaded, ll));
+
+    const auto hashed = deserialize<HashedLinkedList<int>>(
+        std::as_bytes(std::span{bytes}));
+    ASSERT_TRUE(hashed);
+    EXPECT_TRUE(hashed->contains(2));
+}
+
+TEST(Serialization, rejectsMalformedInput) {
+    const LinkedList<int> ll{1, 2, 3};
+    std::vector<std::byte> buffer(serialized_size(ll));
+    ASSERT_TRUE(serialize(ll, std::span{buffer}));
+    const std::span<const std::byte> bytes{buffer};
+
+    EXPECT_EQ(deserialize<LinkedList<int>>(bytes.first(10)).error(),
+              SerializationError::Truncated);
+    EXPECT_EQ(deserialize<LinkedList<int>>(bytes.first(30)).error(),
+              SerializationError::Truncated);
+    EXPECT_EQ(deserialize<LinkedList<std::int64_t>>(bytes).error(),
+              SerializationError::IncompatibleFormat);
+    EXPECT_EQ(deserialize<LinkedList<std::string>>(bytes).error(),
+              SerializationError::IncompatibleFormat);
+
+    auto corrupt = buffer;
+    corrupt[0] = std::byte{'X'};
+    EXPECT_EQ(deserialize<LinkedList<int>>(std::span{std::as_const(corrupt)})
+                  .error(),
+              SerializationError::InvalidHeader);
+
+    corrupt = buffer;
+    corrupt[4] = std::byte{9};
+    EXPECT_EQ(deserialize<LinkedList<int>>(std::span{std::as_const(corrupt)})
+                  .error(),
+              SerializationError::UnsupportedVersion);
+
+    std::stringstream truncated{std::string(
+        reinterpret_cast<const char*>(buffer.data()), buffer.size() - 1)};
+    EXPECT_EQ(deserialize<LinkedList<int>>(truncated).error(),
+              SerializationError::Truncated);
+}
+
+TEST(Serialization, reportsSmallBuffer) {
+    const LinkedList<int> ll{1, 2, 3};
+    std::vector<std::byte> buffer(serialized_size(ll) - 1);
+    EXPECT_EQ(serialize(ll, std::span{buffer}).error(),
+              SerializationError::BufferTooSmall);
+
+    const LinkedList<std::string> strings{"abc"};
+    std::vector<std::byte> small(serialized_size(strings) - 1);
+    EXPECT_EQ(serialize(strings, std::span{small}).error(),
+              SerializationError::BufferTooSmall);
+}
+
+TEST(Serialization, rejectsOversizedCount) {
+    const auto with_count = [](auto ll, std::uint64_t count) {
+        std::stringstream ss;
+        EXPECT_TRUE(serialize(ll, ss));
+        auto bytes = ss.str();
+        std::memcpy(bytes.data() + 16, &count, sizeof(count));
+        return bytes;
+    };
+    constexpr std::uint64_t huge{std::uint64_t{1} << 60};
+
+    auto ints = with_count(LinkedList<int>{1, 2, 3}, huge);
+    std::stringstream seekable{ints};
+    EXPECT_EQ(deserialize<LinkedList<int>>(seekable).error(),
+              SerializationError::Truncated);
+
+    UnseekableBuffer buffer{ints};
+    std::istream unseekable{&buffer};
+    EXPECT_EQ(deserialize<LinkedList<int>>(unseekable).error(),
+              SerializationError::Truncated);
+
+    auto strings = with_count(LinkedList<std::string>{"a", "b"}, huge);
+    std::stringstream string_stream{strings};
+    EXPECT_EQ(deserialize<LinkedList<std::string>>(string_stream).error(),
+              SerializationError::Truncated);
+}
@@ -0,0 +1,191 @@
+#include "LinkedList/StaticLinkedList.hpp"
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <format>
+#include <memory>
+#include <new>
+#include <string>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+constexpr auto make_primes() {
+    StaticLinkedList<int, 8> primes{};
+    for (int candidate{2}; !primes.is_full(); ++candidate) {
+        bool is_prime{true};
+        for (const auto prime : primes) {
+            if (candidate % prime == 0) is_prime = false;
+        }
+        if (is_prime) primes.push_back(candidate);
+    }
+    return primes;
+}
+
+}
+
+TEST(StaticLinkedList, canCreateEmptyList) {
+    StaticLinkedList<int, 4> ll{};
+
+    EXPECT_TRUE(ll.is_empty());
+    EXPECT_EQ(ll.size(), 0);
+    EXPECT_EQ(ll.capacity(), 4);
+    EXPECT_EQ(ll.begin(), ll.end());
+    EXPECT_EQ(ll.front(), std::unexpected(LinkedListError::EmptyList));
+    EXPECT_EQ(ll.back(), std::unexpected(LinkedListError::EmptyList));
+    EXPECT_EQ(std::format("{}", ll), "[NULL]");
+}
+
+TEST(StaticLinkedList, linksAreSmallIndices) {
+    static_assert(std::is_same_v<static_list_index_t<100>, std::uint8_t>);
+    static_assert(std::is_same_v<static_list_index_t<1'000>, std::uint16_t>);
+    static_assert(std::is_same_v<static_list_index_t<100'000>,
+                                 std::uint32_t>);
+
+    static_assert(sizeof(StaticNode<int, std::uint8_t>) <= sizeof(int) * 2);
+    static_assert(sizeof(StaticNode<int, std::uint8_t>) < sizeof(Node<int>));
+}
+
+TEST(StaticLinkedList, canBeBuiltAtCompileTime) {
+    static constexpr auto primes = make_primes();
+
+    static_assert(primes.size() == 8);
+    static_assert(primes.contains(13));
+    static_assert(!primes.contains(9));
+    static_assert(*primes.back() == 19);
+
+    constexpr StaticLinkedList<int, 4> ll{1, 2, 3};
+    static_assert(ll.front().value() == 1);
+    static_assert(ll == StaticLinkedList<int, 4>{1, 2, 3});
+
+    EXPECT_EQ(std::format("{}", primes),
+              "[2 -> 3 -> 5 -> 7 -> 11 -> 13 -> 17 -> 19 -> NULL]");
+}
+
+TEST(StaticLinkedList, constexprMutation) {
+    // std::vector is not trivially destructible, so this also covers
+    // destroying elements during constant evaluation.
+    constexpr auto result = [] {
+        StaticLinkedList<std::vector<int>, 4> ll{};
+        ll.push_back({2});
+        ll.push_front({1});
+        ll.emplace_back(2, 3);
+        ll.remove({2});
+        ll.pop_front();
+        ll.push_back({4});
+        ll.remove_all({3, 3});
+        return ll.size() * 10 + ll.front()->get().front();
+    }();
+
+    static_assert(result == 14);
+}
+
+TEST(StaticLinkedList, pushAndPop) {
+    StaticLinkedList<int, 4> ll{};
+
+    ll.push_back(2);
+    ll.push_front(1);
+    ll.push_back(3);
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 2 -> 3 -> NULL]");
+    EXPECT_EQ(ll.back(), 3);
+
+    ll.pop_back();
+    EXPECT_EQ(ll.back(), 2);
+    ll.pop_front();
+    EXPECT_EQ(ll.front(), 2);
+    ll.pop_back();
+    EXPECT_TRUE(ll.is_empty());
+    ll.pop_back();
+    ll.pop_front();
+    EXPECT_TRUE(ll.is_empty());
+}
+
+TEST(StaticLinkedList, freedNodesAreReused) {
+    StaticLinkedList<int, 3> ll{};
+
+    for (int i{}; i < 100; ++i) {
+        ll.push_back(i);
+        ll.push_back(i + 1);
+        ll.push_back(i + 2);
+        EXPECT_TRUE(ll.is_full());
+        ll.remove(i + 1);
+        ll.pop_front();
+        ll.pop_front();
+    }
+    EXPECT_TRUE(ll.is_empty());
+}
+
+TEST(StaticLinkedList, fullListRejectsElements) {
+    StaticLinkedList<int, 2> ll{1, 2};
+
+    EXPECT_THROW(ll.push_back(3), std::bad_alloc);
+    EXPECT_THROW(ll.push_front(0), std::bad_alloc);
+    EXPECT_EQ(ll.try_emplace_back(3),
+              std::unexpected(LinkedListError::CapacityExceeded));
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 2 -> NULL]");
+
+    ll.pop_front();
+    auto added = ll.try_emplace_front(0);
+    ASSERT_TRUE(added.has_value());
+    EXPECT_EQ(added->get(), 0);
+    EXPECT_EQ(std::format("{}", ll), "[0 -> 2 -> NULL]");
+}
+
+TEST(StaticLinkedList, emplaceAfter) {
+    StaticLinkedList<int, 4> ll{1, 3};
+
+    auto it = ll.emplace_after(ll.begin(), 2);
+    EXPECT_EQ(*it, 2);
+    ll.emplace_after(++it, 4);
+
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 2 -> 3 -> 4 -> NULL]");
+    EXPECT_EQ(ll.back(), 4);
+}
+
+TEST(StaticLinkedList, removeAll) {
+    StaticLinkedList<int, 8> ll{1, 2, 1, 3, 1};
+
+    ll.remove_all(1);
+    EXPECT_EQ(std::format("{}", ll), "[2 -> 3 -> NULL]");
+    EXPECT_EQ(ll.size(), 2);
+    EXPECT_EQ(ll.back(), 3);
+
+    ll.push_back(4);
+    EXPECT_EQ(std::format("{}", ll), "[2 -> 3 -> 4 -> NULL]");
+
+    ll.remove_all(2);
+    ll.remove_all(3);
+    ll.remove_all(4);
+    EXPECT_TRUE(ll.is_empty());
+    EXPECT_FALSE(ll.back().has_value());
+}
+
+TEST(StaticLinkedList, copyAndMove) {
+    StaticLinkedList<std::unique_ptr<int>, 4> owners{};
+    owners.push_back(std::make_unique<int>(1));
+    owners.push_back(std::make_unique<int>(2));
+
+    auto moved = std::move(owners);
+    EXPECT_TRUE(owners.is_empty());
+    EXPECT_EQ(*moved.back()->get(), 2);
+
+    StaticLinkedList<std::string, 4> l1{"a", "b"};
+    auto l2 = l1;
+    l2.push_back("c");
+    EXPECT_EQ(std::format("{}", l1), "[a -> b -> NULL]");
+    EXPECT_EQ(std::format("{}", l2), "[a -> b -> c -> NULL]");
+
+    l1 = l2;
+    EXPECT_EQ(l1, l2);
+}
+
+TEST(StaticLinkedList, outputStream) {
+    StaticLinkedList<int, 4> ll{1, 2};
+    std::ostringstream os;
+
+    os << ll;
+
+    EXPECT_EQ(os.str(), "[1 -> 2 -> NULL]");
+}
@@ -0,0 +1,295 @@
+#include "LinkedList/UnrolledLinkedList.hpp"
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <format>
+#include <string>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+struct ThrowingMove {
+    static inline bool fail{};
+
+    int value;
+
+    explicit ThrowingMove(int v) : value{v} {}
+
+    ThrowingMove(const ThrowingMove&) = default;
+    ThrowingMove(ThrowingMove&& other) : value{other.value} {
+        if (fail) throw std::runtime_error{"move"};
+    }
+    ThrowingMove& operator=(ThrowingMove&&) = default;
+};
+
+template <typename List>
+std::vector<int> values(const List& ll) {
+    std::vector<int> result;
+    for (const auto& element : ll) result.push_back(element.value);
+    return result;
+}
+
+}
+
+TEST(UnrolledLinkedList, canCreateEmptyList) {
+    UnrolledLinkedList<int> ll{};
+
+    EXPECT_TRUE(ll.is_empty());
+    EXPECT_EQ(ll.size(), 0);
+    EXPECT_EQ(ll.begin(), ll.end());
+    EXPECT_EQ(ll.front(), std::unexpected(LinkedListError::EmptyList));
+    EXPECT_EQ(ll.back(), std::unexpected(LinkedListError::EmptyList));
+}
+
+TEST(UnrolledLinkedList, shouldDeduceType) {
+    UnrolledLinkedList ll{7};
+
+    EXPECT_EQ(ll.size(), 1);
+    EXPECT_EQ(ll.front(), 7);
+    EXPECT_EQ(ll.back(), 7);
+}
+
+TEST(UnrolledLinkedList, pushBackKeepsOrderAcrossNodes) {
+    UnrolledLinkedList<int, 4> ll{};
+
+    for (int i{}; i < 10; ++i) {
+        ll.push_back(i);
+    }
+
+    EXPECT_EQ(ll.size(), 10);
+    EXPECT_EQ(ll.front(), 0);
+    EXPECT_EQ(ll.back(), 9);
+
+    int expected{};
+    for (const auto element : ll) {
+        EXPECT_EQ(element, expected++);
+    }
+    EXPECT_EQ(expected, 10);
+}
+
+TEST(UnrolledLinkedList, pushFrontKeepsLifoOrder) {
+    UnrolledLinkedList<int, 4> ll{};
+
+    for (int i{}; i < 10; ++i) {
+        ll.push_front(i);
+    }
+
+    EXPECT_EQ(ll.size(), 10);
+    EXPECT_EQ(ll.front(), 9);
+    EXPECT_EQ(ll.back(), 0);
+    EXPECT_EQ(std::format("{}", ll),
+        "[9 -> 8 -> 7 -> 6 -> 5 -> 4 -> 3 -> 2 -> 1 -> 0 -> NULL]");
+}
+
+TEST(UnrolledLinkedList, popFrontAndPopBack) {
+    UnrolledLinkedList<int, 3> ll{1, 2, 3, 4, 5, 6, 7};
+
+    ll.pop_front();
+    ll.pop_back();
+    EXPECT_EQ(ll.front(), 2);
+    EXPECT_EQ(ll.back(), 6);
+
+    while (!ll.is_empty()) {
+        ll.pop_back();
+    }
+    EXPECT_EQ(ll.size(), 0);
+    EXPECT_FALSE(ll.back().has_value());
+
+    ll.pop_front();
+    ll.pop_back();
+    EXPECT_TRUE(ll.is_empty());
+
+    ll.push_back(1);
+    EXPECT_EQ(ll.front(), 1);
+    EXPECT_EQ(ll.back(), 1);
+}
+
+TEST(UnrolledLinkedList, popFrontLeavesSlotsForPushFrontAndPushBack) {
+    UnrolledLinkedList<int, 4> ll{0, 1, 2, 3, 4, 5};
+
+    ll.pop_front();
+    ll.pop_front();
+    ll.push_front(-1);
+    EXPECT_EQ(std::format("{}", ll), "[-1 -> 2 -> 3 -> 4 -> 5 -> NULL]");
+
+    // Used as a queue the list keeps its order while nodes drain from the
+    // front and fill at the back.
+    for (int i{6}; i < 40; ++i) {
+        ll.push_back(i);
+        ll.pop_front();
+        EXPECT_EQ(ll.front(), i - 4);
+        EXPECT_EQ(ll.back(), i);
+    }
+    EXPECT_EQ(ll.size(), 5);
+    EXPECT_EQ(std::format("{}", ll), "[35 -> 36 -> 37 -> 38 -> 39 -> NULL]");
+
+    while (ll.size() > 1) ll.pop_front();
+    ll.push_back(40);
+    ll.push_front(38);
+    EXPECT_EQ(std::format("{}", ll), "[38 -> 39 -> 40 -> NULL]");
+    ll.remove(39);
+    ll.pop_back();
+    EXPECT_EQ(std::format("{}", ll), "[38 -> NULL]");
+}
+
+TEST(UnrolledLinkedList, failedPushLeavesListUnchanged) {
+    UnrolledLinkedList<ThrowingMove, 2> ll{};
+    const ThrowingMove element{3};
+
+    ThrowingMove::fail = true;
+    EXPECT_THROW(ll.push_front(element), std::runtime_error);
+    EXPECT_THROW(ll.push_back(element), std::runtime_error);
+    EXPECT_TRUE(ll.is_empty());
+    ThrowingMove::fail = false;
+
+    ll.push_back(ThrowingMove{1});
+    ll.push_back(ThrowingMove{2});
+
+    ThrowingMove::fail = true;
+    EXPECT_THROW(ll.push_front(element), std::runtime_error);
+    EXPECT_THROW(ll.push_back(element), std::runtime_error);
+    ThrowingMove::fail = false;
+
+    EXPECT_EQ(ll.size(), 2);
+    EXPECT_EQ(ll.front()->get().value, 1);
+    EXPECT_EQ(ll.back()->get().value, 2);
+    EXPECT_EQ(values(ll), (std::vector{1, 2}));
+}
+
+TEST(UnrolledLinkedList, canModifyElementsThroughIterators) {
+    UnrolledLinkedList<int, 2> ll{1, 2, 3};
+
+    for (auto& element : ll) {
+        element *= 2;
+    }
+    ll.front().value().get() = 0;
+
+    EXPECT_EQ(std::format("{}", ll), "[0 -> 4 -> 6 -> NULL]");
+}
+
+TEST(UnrolledLinkedList, contains) {
+    UnrolledLinkedList<int, 4> ll{1, 3, 5, 7, 9, 11};
+
+    EXPECT_TRUE(ll.contains(1));
+    EXPECT_TRUE(ll.contains(9));
+    EXPECT_TRUE(ll.contains(11));
+    EXPECT_FALSE(ll.contains(4));
+    EXPECT_FALSE(UnrolledLinkedList<int>{}.contains(4));
+}
+
+TEST(UnrolledLinkedList, removeRemovesOnlyFirstOccurrence) {
+    UnrolledLinkedList<int, 2> ll{1, 2, 2, 3};
+
+    ll.remove(2);
+
+    EXPECT_EQ(ll.size(), 3);
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 2 -> 3 -> NULL]");
+
+    ll.remove(3);
+    ll.remove(1);
+    ll.remove(2);
+    ll.remove(2);
+
+    EXPECT_TRUE(ll.is_empty());
+    EXPECT_FALSE(ll.back().has_value());
+}
+
+TEST(UnrolledLinkedList, removeKeepsBackCorrect) {
+    UnrolledLinkedList<int, 4> ll{1, 2, 3, 4, 5};
+
+    ll.remove(5);
+    EXPECT_EQ(ll.back(), 4);
+
+    ll.push_back(6);
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 2 -> 3 -> 4 -> 6 -> NULL]");
+}
+
+TEST(UnrolledLinkedList, removeAll) {
+    UnrolledLinkedList<int, 3> ll{1, 3, 1, 1, 1, 4, 1, 1, 1, 5, 1};
+
+    ll.remove_all(1);
+
+    EXPECT_EQ(ll.size(), 3);
+    EXPECT_EQ(ll.back(), 5);
+    EXPECT_EQ(std::format("{}", ll), "[3 -> 4 -> 5 -> NULL]");
+
+    ll.remove_all(3);
+    ll.remove_all(4);
+    ll.remove_all(5);
+    EXPECT_TRUE(ll.is_empty());
+    EXPECT_FALSE(ll.back().has_value());
+}
+
+TEST(UnrolledLinkedList, removeAllMergesUnderfilledNodes) {
+    UnrolledLinkedList<std::string, 4> ll{};
+    for (int i{}; i < 40; ++i) {
+        ll.push_back(i % 4 == 0 ? std::to_string(i) : "x");
+    }
+
+    ll.remove_all("x");
+
+    EXPECT_EQ(ll.size(), 10);
+    EXPECT_EQ(ll.front()->get(), "0");
+    EXPECT_EQ(ll.back()->get(), "36");
+    EXPECT_EQ(std::format("{}", ll),
+        "[0 -> 4 -> 8 -> 12 -> 16 -> 20 -> 24 -> 28 -> 32 -> 36 -> NULL]");
+}
+
+TEST(UnrolledLinkedList, copyMoveAndSwap) {
+    UnrolledLinkedList<int, 2> l1{1, 2, 3};
+    UnrolledLinkedList<int, 2> l2 = l1;
+    EXPECT_EQ(l1, l2);
+
+    UnrolledLinkedList<int, 2> l3{std::move(l1)};
+    EXPECT_TRUE(l1.is_empty());
+    EXPECT_EQ(l3, l2);
+
+    UnrolledLinkedList<int, 2> l4{9};
+    swap(l3, l4);
+    EXPECT_EQ(l3.front(), 9);
+    EXPECT_EQ(l4.back(), 3);
+
+    l3 = l4;
+    EXPECT_EQ(l3, l4);
+    l3 = std::move(l2);
+    EXPECT_EQ(l3, l4);
+    EXPECT_TRUE(l2.is_empty());
+}
+
+TEST(UnrolledLinkedList, elementsAreDestroyedOnce) {
+    auto counter = std::make_shared<int>(0);
+    {
+        UnrolledLinkedList<std::shared_ptr<int>, 3> ll{};
+        for (int i{}; i < 10; ++i) {
+            ll.push_back(counter);
+            ll.push_front(counter);
+        }
+        ll.remove(counter);
+        ll.pop_back();
+        ll.pop_front();
+        EXPECT_EQ(counter.use_count(), 18);
+    }
+    EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(UnrolledLinkedList, shouldWorkWithStdFormatAndOutputStream) {
+    UnrolledLinkedList ll{1, 3};
+
+    std::stringstream ss;
+    ss << ll;
+    EXPECT_EQ(ss.str(), "[1 -> 3 -> NULL]");
+    EXPECT_EQ(std::format("{}", ll), "[1 -> 3 -> NULL]");
+
+    ll.clear();
+    EXPECT_EQ(std::format("{}", ll), "[NULL]");
+}
+
+TEST(UnrolledLinkedList, defaultConstructorShouldBeConstexpr) {
+    constexpr UnrolledLinkedList<int> ll{};
+
+    static_assert(ll.is_empty(), "Must be constexpr");
+    static_assert(!ll.contains(3), "Must be constexpr");
+}